@@ -0,0 +1,470 @@
+#ifndef AZDO_RENDERER_H
+#define AZDO_RENDERER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "bvh.h"
+#include "cell_portal.h"
+#include "culling.h"
+#include "frame_data.h"
+#include "frustum.h"
+#include "gl_state.h"
+#include "mesh_optimize.h"
+#include "mesh_weld.h"
+#include "meshlet.h"
+#include "procedural_mesh.h"
+#include "shader_program.h"
+#include "software_occlusion.h"
+#include "static_batch.h"
+#include "transform_buffer.h"
+#include "vertex_format.h"
+
+// Çizim başına dönüşümlerin bağlandığı shader storage noktası
+// (shaderdaki layout (std430, binding = 1) ile aynı olmalı)
+const GLuint TRANSFORM_STORAGE_BINDING = 1;
+
+// glMultiDrawElementsIndirect'in okuduğu komut (GL spesifikasyonundaki düzen)
+struct DrawElementsIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance; // Çizim indeksi olarak kullanılır
+};
+
+// OpenGL 4.5 "AZDO" yolu (Approaching Zero Driver Overhead):
+//  - bütün nesneler DSA ile oluşturulur, kurulumda hiçbir şey bağlanmaz;
+//  - kare verisi, dönüşümler ve indirect komutlar kalıcı eşlenmiş
+//    (persistent, coherent) bir halka tamponuna doğrudan yazılır; 3 bölge
+//    fence'lerle korunur;
+//  - bütün sahne tek glMultiDrawElementsIndirect çağrısıyla çizilir; komutlar
+//    her karede yazıldığı için LOD seçimi yeniden yükleme gerektirmez;
+//  - meshler kümelere (meshlet) bölünür, her küme bir komut olur; halkaya
+//    sadece görüş hacminde kalan nesnelerin (BVH üzerinde) kameraya dönük ve
+//    görüş hacmindeki kümelerinin komutları yazılır; BVH'de sadece modeli
+//    değişen çizim indekslerinin nesneleri güncellenir.
+// Çizim indeksi baseInstance'tan gelir: 0, 1, 2, ... içeren örnek başına bir
+// attribute (divisor 1) baseInstance kadar kaydırılarak okunur; böylece
+// gl_DrawID / ARB_shader_draw_parameters gerekmez.
+// GL 3.3 yolu (MeshArena + RenderQueue) yedek olarak kalır.
+class AzdoRenderer
+{
+public:
+    static const int FRAME_COUNT = 3;
+    static const GLuint MAX_DRAWS = 1024;
+    using DrawIndexLayout = VertexLayout<UInt1<3>>; // Örnek başına çizim indeksi
+
+    static bool supported()
+    {
+        return GLEW_VERSION_4_5;
+    }
+
+    // 9 float'lık vertexleri ekler; şerit ve yelpazeler üçgen listesine
+    // çevrilir, vertexler kaynaklanır ve mesh kümelere bölünür: her küme
+    // ayrı bir indirect komutu olur. Kümeler sadece closed meshlerde normal
+    // konisiyle ayıklanır (açık yüzeyler iki yüzlü çizilir)
+    void addMesh(const float *data, size_t vertexCount, GLenum mode, GLuint drawIndex, bool closed = false)
+    {
+        std::vector<float> triangles = toTriangleList(data, vertexCount, mode);
+        WeldedMesh mesh = weldVertices(triangles.data(), triangles.size() / 9);
+        mesh.vertices.resize(optimizeMesh(mesh.vertices.data(), mesh.vertices.size() / 9, mesh.indices.data(),
+                                          mesh.indices.size(), &cacheStats) * 9);
+        std::vector<Meshlet> meshlets = buildMeshlets(mesh.vertices.data(), mesh.vertices.size() / 9,
+                                                      mesh.indices.data(), mesh.indices.size());
+        addObject(computeBounds(mesh.vertices.data(), mesh.vertices.size() / 9, 9), drawIndex, meshlets.size());
+
+        for (const Meshlet &meshlet : meshlets)
+        {
+            DrawElementsIndirectCommand command;
+            command.count = meshlet.triangleCount * 3;
+            command.instanceCount = 1;
+            command.firstIndex = (GLuint)(indexTotal + meshlet.firstIndex);
+            command.baseVertex = (GLint)vertexTotal;
+            command.baseInstance = drawIndex;
+            commands.push_back(command);
+            commandBounds.push_back(meshlet.bounds);
+            if (!closed)
+                commandBounds.back().coneCutoff = 1.0f;
+        }
+
+        meshSpans.push_back({vertices.size() / 9, vertexTotal, mesh.vertices.size() / 9, indices.size(), indexTotal,
+                             mesh.indices.size()});
+        vertexTotal += mesh.vertices.size() / 9;
+        indexTotal += mesh.indices.size();
+        vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+        indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+    }
+
+    // Prosedürel mesh zaten indeksli üretilir; kaynaklamaya gerek yok. LOD
+    // seviyeleri bütün olarak seçildiği için kümelere bölünmez, tek komut olur.
+    // Burada sadece yeri ayrılır (boyutlar tanımdan); vertexler create()
+    // sırasında üretilir. Komutun indeksini döndürür (setCommandEnabled için)
+    size_t addProcedural(const ProceduralMeshDesc &desc, GLuint drawIndex)
+    {
+        const ProceduralMeshSize size = proceduralMeshSize(desc);
+        procedural.push_back({{desc, vertexTotal, indexTotal}, objects.size(), commands.size()});
+        addObject(ObjectBounds(), drawIndex, 1);
+        DrawElementsIndirectCommand command;
+        command.count = (GLuint)size.indexCount;
+        command.instanceCount = 1;
+        command.firstIndex = (GLuint)indexTotal;
+        command.baseVertex = (GLint)vertexTotal;
+        command.baseInstance = drawIndex;
+        commands.push_back(command);
+        commandBounds.push_back(MeshletBounds()); // create() içinde hesaplanır
+
+        vertexTotal += size.vertexCount;
+        indexTotal += size.indexCount;
+        return commands.size() - 1;
+    }
+
+    // Kapalı komut instanceCount = 0 ile hiçbir şey çizmez (LOD seçimi gibi);
+    // komutlar her karede halkaya yazıldığı için değişiklik sonraki karede geçerli
+    void setCommandEnabled(size_t command, bool enabled)
+    {
+        commands[command].instanceCount = enabled ? 1 : 0;
+    }
+
+    // Statik yığının her nesnesi kümeleriyle ayrı komutlar olur (hepsi aynı çizim indeksiyle)
+    void addStaticBatch(const StaticBatch &batch, GLuint drawIndex)
+    {
+        const std::vector<float> &data = batch.vertexData();
+        for (const StaticBatch::Object &object : batch.objectList())
+            addMesh(data.data() + object.first * 9, object.count, GL_TRIANGLES, drawIndex, object.closed);
+    }
+
+    // Geometriyi yükler, halka tamponunu eşler ve programı hazırlar
+    template <class Layout>
+    void create(const char *vertexShaderSource, const char *fragmentShaderSource)
+    {
+        // Prosedürel meshler tam boyutlu tek bir alana (9 float'lık vertex)
+        // üretilir ve orada sıralanır; sıralama vertexleri okuduğu için
+        // eşlenmiş (yalnızca yazılan) GPU belleğinde yapılmaz
+        std::vector<ProceduralMeshTarget> targets;
+        size_t proceduralVertices = 0, proceduralIndices = 0;
+        for (const ProceduralSlot &slot : procedural)
+        {
+            const ProceduralMeshSize size = proceduralMeshSize(slot.target.desc);
+            targets.push_back({slot.target.desc, proceduralVertices, proceduralIndices});
+            proceduralVertices += size.vertexCount;
+            proceduralIndices += size.indexCount;
+        }
+        std::vector<float> generatedVertices(proceduralVertices * 9);
+        std::vector<uint32_t> generatedIndices(proceduralIndices);
+        writeProceduralMeshes<FloatVertexLayout, uint32_t>(targets, (unsigned char *)generatedVertices.data(),
+                                                           generatedIndices.data());
+        for (size_t i = 0; i < procedural.size(); ++i)
+        {
+            float *meshVertices = &generatedVertices[targets[i].firstVertex * 9];
+            uint32_t *meshIndices = &generatedIndices[targets[i].firstIndex];
+            const size_t indexCount = commands[procedural[i].command].count;
+            const size_t vertexCount = optimizeMesh(meshVertices, proceduralMeshSize(targets[i].desc).vertexCount,
+                                                    meshIndices, indexCount, &cacheStats);
+            commandBounds[procedural[i].command] = computeMeshletBounds(meshVertices, meshIndices, indexCount);
+            objects[procedural[i].object].bounds = computeBounds(meshVertices, vertexCount, 9);
+        }
+
+        // Değişmez (immutable) geometri: tam boyutta ayrılır, eşlenip doğrudan
+        // seçilen düzende yazılır
+        std::vector<GLuint> drawIndices(MAX_DRAWS);
+        for (GLuint i = 0; i < MAX_DRAWS; ++i)
+            drawIndices[i] = i;
+
+        glCreateBuffers(1, &vertexBuffer);
+        glCreateBuffers(1, &indexBuffer);
+        glCreateBuffers(1, &drawIndexBuffer);
+        glNamedBufferStorage(vertexBuffer, vertexTotal * Layout::stride, NULL, GL_MAP_WRITE_BIT);
+        glNamedBufferStorage(indexBuffer, indexTotal * sizeof(uint32_t), NULL, GL_MAP_WRITE_BIT);
+        glNamedBufferStorage(drawIndexBuffer, drawIndices.size() * sizeof(GLuint), drawIndices.data(), 0);
+
+        const GLbitfield writeFlags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+        unsigned char *gpuVertices =
+            (unsigned char *)glMapNamedBufferRange(vertexBuffer, 0, vertexTotal * Layout::stride, writeFlags);
+        uint32_t *gpuIndices =
+            (uint32_t *)glMapNamedBufferRange(indexBuffer, 0, indexTotal * sizeof(uint32_t), writeFlags);
+        if (gpuVertices && gpuIndices)
+        {
+            for (const MeshSpan &span : meshSpans)
+            {
+                convertVerticesInto<Layout>(&vertices[span.sourceVertex * 9], span.vertexCount,
+                                            gpuVertices + span.targetVertex * Layout::stride);
+                std::memcpy(gpuIndices + span.targetIndex, &indices[span.sourceIndex],
+                            span.indexCount * sizeof(uint32_t));
+            }
+            for (size_t i = 0; i < procedural.size(); ++i)
+            {
+                const ProceduralMeshTarget &target = procedural[i].target;
+                const ProceduralMeshSize size = proceduralMeshSize(target.desc);
+                convertVerticesInto<Layout>(&generatedVertices[targets[i].firstVertex * 9], size.vertexCount,
+                                            gpuVertices + target.firstVertex * Layout::stride);
+                std::memcpy(gpuIndices + target.firstIndex, &generatedIndices[targets[i].firstIndex],
+                            size.indexCount * sizeof(uint32_t));
+            }
+        }
+        else if (vertexTotal > 0)
+            std::cerr << "ERROR::AZDO::GEOMETRY_MAP_FAILED" << std::endl;
+        if (gpuVertices)
+            glUnmapNamedBuffer(vertexBuffer);
+        if (gpuIndices)
+            glUnmapNamedBuffer(indexBuffer);
+
+        glCreateVertexArrays(1, &vao);
+        glVertexArrayVertexBuffer(vao, 0, vertexBuffer, 0, Layout::stride);
+        Layout::setup(vao, 0);
+        glVertexArrayVertexBuffer(vao, 1, drawIndexBuffer, 0, DrawIndexLayout::stride);
+        glVertexArrayBindingDivisor(vao, 1, 1);
+        DrawIndexLayout::setup(vao, 1);
+        glVertexArrayElementBuffer(vao, indexBuffer);
+
+        // Kalıcı eşlenmiş halka: her bölgede FrameData + MAX_DRAWS dönüşüm + komutlar
+        GLint uniformAlignment = 256, storageAlignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+        GLsizeiptr alignment = uniformAlignment > storageAlignment ? uniformAlignment : storageAlignment;
+        transformOffset = alignUp(sizeof(FrameData), alignment);
+        commandOffset = alignUp(transformOffset + MAX_DRAWS * sizeof(DrawTransform), alignment);
+        regionSize = alignUp(commandOffset + commands.size() * sizeof(DrawElementsIndirectCommand), alignment);
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &ringBuffer);
+        glNamedBufferStorage(ringBuffer, regionSize * FRAME_COUNT, NULL, flags);
+        ringData = (unsigned char *)glMapNamedBufferRange(ringBuffer, 0, regionSize * FRAME_COUNT, flags);
+        if (!ringData)
+            std::cerr << "ERROR::AZDO::RING_BUFFER_MAP_FAILED" << std::endl;
+
+        program = ShaderProgram(createShaderProgram(vertexShaderSource, fragmentShaderSource));
+        program.bindUniformBlock("FrameData", FRAME_DATA_BINDING);
+
+        std::cout << "AZDO: " << commands.size() << " indirect komut, " << vertexTotal << " vertex, " << indexTotal
+                  << " indeks" << std::endl;
+        cacheStats.print(std::cout);
+
+        std::vector<float>().swap(vertices);
+        std::vector<uint32_t>().swap(indices);
+        std::vector<MeshSpan>().swap(meshSpans);
+        std::vector<ProceduralSlot>().swap(procedural);
+    }
+
+    // Kare verisini ve modelleri (models[i] = çizim indeksi i) halkaya yazar,
+    // kümeleri ayıklayıp kalan komutları yazar, bütün sahneyi tek çağrıyla
+    // çizer. occlusion verildiyse (bu karenin kamerasıyla çizilmiş) örtücülerin
+    // arkasında kalan nesneler de atlanır. portals verildiyse (bu kare için
+    // update() edilmiş) ulaşılmayan hücrelerdeki nesneler de atlanır.
+    void draw(const FrameData &frame, const glm::mat4 *models, size_t modelCount,
+              const SoftwareOcclusion *occlusion = nullptr, const CellPortalGraph *portals = nullptr)
+    {
+        if (!ringData || modelCount > MAX_DRAWS)
+            return;
+
+        // GPU bu bölgeyi hâlâ okuyor olabilir
+        if (fences[frameIndex])
+        {
+            glClientWaitSync(fences[frameIndex], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(fences[frameIndex]);
+            fences[frameIndex] = 0;
+        }
+
+        const GLintptr region = regionSize * frameIndex;
+        std::memcpy(ringData + region, &frame, sizeof(FrameData));
+        computeDrawTransforms(models, modelCount, frame.viewProjection,
+                              (DrawTransform *)(ringData + region + transformOffset));
+
+        // Çizim listesi: önce nesneler dünya uzayı sınırlarıyla görüş hacmine
+        // karşı test edilir; görünen nesnelerin kapalı (LOD), görüş hacmi
+        // dışında ya da kameraya arkasını dönen kümeleri yazılmaz
+        const Frustum frustum = extractFrustum(frame.viewProjection);
+        const glm::vec3 cameraPos = glm::vec3(frame.viewPos);
+        updateBvh(models, modelCount);
+        visibleObjects.clear();
+        bvh.cull(frustum, [&](uint32_t object)
+                 { visibleObjects.push_back(object); });
+        std::sort(visibleObjects.begin(), visibleObjects.end()); // Çizim sırası eklenme sırası kalsın
+
+        DrawElementsIndirectCommand *drawList = (DrawElementsIndirectCommand *)(ringData + region + commandOffset);
+        GLsizei drawCount = 0;
+        stats = CullStats();
+        stats.objects = objects.size();
+        stats.clusters = commands.size();
+        for (uint32_t o : visibleObjects)
+        {
+            const MeshObject &object = objects[o];
+            if (object.drawIndex >= modelCount)
+                continue;
+            const ObjectBounds &bounds = bvh.itemBounds(o);
+            if (portals && !portals->visible(bounds.boundsMin, bounds.boundsMax))
+                continue;
+            if (occlusion && !occlusion->visible(bounds.boundsMin, bounds.boundsMax))
+            {
+                ++stats.occludedObjects;
+                continue;
+            }
+            ++stats.visibleObjects;
+            for (size_t i = object.firstCommand; i < object.firstCommand + object.commandCount; ++i)
+            {
+                const DrawElementsIndirectCommand &command = commands[i];
+                if (command.instanceCount == 0 ||
+                    !meshletVisible(commandBounds[i], models[object.drawIndex], cameraPos, frustum))
+                    continue;
+                drawList[drawCount++] = command;
+            }
+        }
+        stats.visibleClusters = (size_t)drawCount;
+
+        glState().bindBufferRange(GL_UNIFORM_BUFFER, FRAME_DATA_BINDING, ringBuffer, region, sizeof(FrameData));
+        glState().bindBufferRange(GL_SHADER_STORAGE_BUFFER, TRANSFORM_STORAGE_BINDING, ringBuffer,
+                                  region + transformOffset, modelCount * sizeof(DrawTransform));
+
+        program.use();
+        glState().bindVertexArray(vao);
+        glState().bindBuffer(GL_DRAW_INDIRECT_BUFFER, ringBuffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void *)(region + commandOffset), drawCount, 0);
+
+        fences[frameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        frameIndex = (frameIndex + 1) % FRAME_COUNT;
+    }
+
+    // Son karenin ayıklama sonucu (küme = komut: meshlet ya da LOD seviyesi)
+    const CullStats &cullStats() const
+    {
+        return stats;
+    }
+
+    // Nesne BVH'si (ilk karede kurulur, sonra refit edilir)
+    const Bvh &objectBvh() const
+    {
+        return bvh;
+    }
+
+    void destroy()
+    {
+        for (GLsync &fence : fences)
+        {
+            if (fence)
+                glDeleteSync(fence);
+            fence = 0;
+        }
+        if (ringData)
+            glUnmapNamedBuffer(ringBuffer);
+        ringData = nullptr;
+
+        glDeleteVertexArrays(1, &vao);
+        GLuint buffers[] = {vertexBuffer, indexBuffer, drawIndexBuffer, ringBuffer};
+        glDeleteBuffers(4, buffers);
+        vao = vertexBuffer = indexBuffer = drawIndexBuffer = ringBuffer = 0;
+        program.destroy();
+    }
+
+private:
+    // Ayıklama birimi: addMesh / addProcedural çağrısı başına bir nesne,
+    // komutları commands içinde ardışık
+    struct MeshObject
+    {
+        size_t firstCommand;
+        size_t commandCount;
+        GLuint drawIndex;
+        ObjectBounds bounds; // Model uzayında
+    };
+
+    // addMesh ile eklenen bir meshin CPU verisindeki (source) ve tampondaki
+    // (target) yeri, vertex ve indeks cinsinden
+    struct MeshSpan
+    {
+        size_t sourceVertex;
+        size_t targetVertex;
+        size_t vertexCount;
+        size_t sourceIndex;
+        size_t targetIndex;
+        size_t indexCount;
+    };
+
+    // addProcedural ile yeri ayrılan mesh; create() üretip nesnenin ve
+    // komutun sınırlarını doldurur
+    struct ProceduralSlot
+    {
+        ProceduralMeshTarget target; // Tampondaki yeri
+        size_t object;
+        size_t command;
+    };
+
+    static GLsizeiptr alignUp(GLsizeiptr value, GLsizeiptr alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void addObject(const ObjectBounds &bounds, GLuint drawIndex, size_t commandCount)
+    {
+        objects.push_back({commands.size(), commandCount, drawIndex, bounds});
+    }
+
+    // Nesnelerin dünya uzayı sınırlarını BVH'ye yansıtır. İlk karede (ya da
+    // model sayısı değişince) ağaç SAH ile kurulur; sonra sadece modeli önceki
+    // kareden farklı olan çizim indekslerinin nesneleri güncellenip sığdırılır.
+    void updateBvh(const glm::mat4 *models, size_t modelCount)
+    {
+        if (lastModels.size() != modelCount)
+        {
+            lastModels.assign(models, models + modelCount);
+            drawIndexObjects.assign(modelCount, std::vector<uint32_t>());
+            std::vector<ObjectBounds> world;
+            world.reserve(objects.size());
+            for (uint32_t o = 0; o < (uint32_t)objects.size(); ++o)
+            {
+                const MeshObject &object = objects[o];
+                const bool placed = object.drawIndex < modelCount;
+                world.push_back(placed ? transformBounds(object.bounds, models[object.drawIndex]) : object.bounds);
+                if (placed)
+                    drawIndexObjects[object.drawIndex].push_back(o);
+            }
+            bvh.build(world);
+            return;
+        }
+
+        for (size_t d = 0; d < modelCount; ++d)
+        {
+            if (models[d] == lastModels[d])
+                continue;
+            lastModels[d] = models[d];
+            for (uint32_t o : drawIndexObjects[d])
+                bvh.update(o, transformBounds(objects[o].bounds, models[d]));
+        }
+        bvh.refit();
+    }
+
+    std::vector<float> vertices; // addMesh meshleri (create()'e kadar)
+    std::vector<uint32_t> indices;
+    std::vector<MeshSpan> meshSpans;
+    std::vector<ProceduralSlot> procedural;
+    size_t vertexTotal = 0; // Tamponlardaki toplam (prosedürel meshler dahil)
+    size_t indexTotal = 0;
+    std::vector<DrawElementsIndirectCommand> commands;
+    std::vector<MeshletBounds> commandBounds; // Komut başına, model uzayında
+    std::vector<MeshObject> objects;
+    Bvh bvh; // Nesnelerin dünya uzayı sınırları
+    std::vector<glm::mat4> lastModels;
+    std::vector<std::vector<uint32_t>> drawIndexObjects;
+    std::vector<uint32_t> visibleObjects;
+    CullStats stats;
+    MeshOptimizeStats cacheStats; // Kaynaklanan / üretilen meshlerin sıralama istatistikleri
+
+    ShaderProgram program;
+    GLuint vao = 0;
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    GLuint drawIndexBuffer = 0;
+    GLuint ringBuffer = 0;
+    unsigned char *ringData = nullptr;
+    GLsizeiptr regionSize = 0;
+    GLsizeiptr transformOffset = 0;
+    GLsizeiptr commandOffset = 0;
+    GLsync fences[FRAME_COUNT] = {};
+    int frameIndex = 0;
+};
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef BOX_BUILDER_H
+#define BOX_BUILDER_H
+
+#include <array>
+#include <cstddef>
+
+// Derleme zamanında (constexpr) vertex üreten dörtgen, kutu ve piramit
+// kurucuları. Çıktı 9 float'lık (pozisyon, normal, renk) GL_TRIANGLES dizisidir;
+// static constexpr bir değişkene atanınca veri .rodata'ya yazılır ve çalışma
+// zamanında hiçbir şey üretilmez. Vertex sayısı dizinin tipindedir, elle
+// yazılan sayılara gerek kalmaz.
+
+// constexpr bağlamda kullanılabilen nokta / vektör (glm::vec3 constexpr değil)
+struct Point3
+{
+    float x, y, z;
+};
+
+template <size_t VertexCount>
+using VertexArray = std::array<float, VertexCount * 9>;
+
+template <size_t N>
+constexpr size_t vertexCount(const std::array<float, N> &)
+{
+    static_assert(N % 9 == 0, "Vertex dizisi 9 float'ın katı olmalı");
+    return N / 9;
+}
+
+template <size_t N>
+constexpr void putVertex(std::array<float, N> &out, size_t &i, Point3 position, Point3 normal, Point3 color)
+{
+    out[i++] = position.x;
+    out[i++] = position.y;
+    out[i++] = position.z;
+    out[i++] = normal.x;
+    out[i++] = normal.y;
+    out[i++] = normal.z;
+    out[i++] = color.x;
+    out[i++] = color.y;
+    out[i++] = color.z;
+}
+
+// Dizileri uç uca ekler
+template <size_t... N>
+constexpr std::array<float, (N + ...)> concat(const std::array<float, N> &...parts)
+{
+    std::array<float, (N + ...)> out{};
+    size_t i = 0;
+    auto append = [&](const auto &part)
+    {
+        for (float f : part)
+            out[i++] = f;
+    };
+    (append(parts), ...);
+    return out;
+}
+
+// a, b, c, d çevresindeki dörtgen; iki üçgen (a b c, c d a)
+constexpr VertexArray<6> quad(Point3 a, Point3 b, Point3 c, Point3 d, Point3 normal, Point3 color)
+{
+    VertexArray<6> out{};
+    size_t i = 0;
+    const Point3 corners[6] = {a, b, c, c, d, a};
+    for (const Point3 &corner : corners)
+        putVertex(out, i, corner, normal, color);
+    return out;
+}
+
+// [lo, hi] eksen hizalı kutusu, 6 yüz x 6 vertex: üst yüz top, alt yüz bottom,
+// dört yan yüz side renginde
+constexpr VertexArray<36> box(Point3 lo, Point3 hi, Point3 top, Point3 side, Point3 bottom)
+{
+    return concat(quad({lo.x, hi.y, lo.z}, {hi.x, hi.y, lo.z}, {hi.x, hi.y, hi.z}, {lo.x, hi.y, hi.z}, {0.0f, 1.0f, 0.0f}, top),
+                  quad({lo.x, lo.y, lo.z}, {hi.x, lo.y, lo.z}, {hi.x, lo.y, hi.z}, {lo.x, lo.y, hi.z}, {0.0f, -1.0f, 0.0f}, bottom),
+                  quad({lo.x, lo.y, hi.z}, {hi.x, lo.y, hi.z}, {hi.x, hi.y, hi.z}, {lo.x, hi.y, hi.z}, {0.0f, 0.0f, 1.0f}, side),
+                  quad({lo.x, lo.y, lo.z}, {hi.x, lo.y, lo.z}, {hi.x, hi.y, lo.z}, {lo.x, hi.y, lo.z}, {0.0f, 0.0f, -1.0f}, side),
+                  quad({lo.x, lo.y, lo.z}, {lo.x, lo.y, hi.z}, {lo.x, hi.y, hi.z}, {lo.x, hi.y, lo.z}, {-1.0f, 0.0f, 0.0f}, side),
+                  quad({hi.x, lo.y, lo.z}, {hi.x, lo.y, hi.z}, {hi.x, hi.y, hi.z}, {hi.x, hi.y, lo.z}, {1.0f, 0.0f, 0.0f}, side));
+}
+
+// abc üçgeninin normali, merkezden (center) dışarı bakacak yönde. Normalize
+// edilmez; yükleme sırasında (StaticBatch, packNormal) ya da shaderda yapılır.
+constexpr Point3 outwardNormal(Point3 a, Point3 b, Point3 c, Point3 center)
+{
+    const Point3 u = {b.x - a.x, b.y - a.y, b.z - a.z};
+    const Point3 v = {c.x - a.x, c.y - a.y, c.z - a.z};
+    const Point3 n = {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+    const float side = n.x * (a.x - center.x) + n.y * (a.y - center.y) + n.z * (a.z - center.z);
+    return side < 0.0f ? Point3{-n.x, -n.y, -n.z} : n;
+}
+
+// Tabanı y = lo.y düzleminde [lo, hi] dikdörtgeni, tepesi apex olan piramit:
+// taban 2, her yan yüz 1 üçgen (18 vertex). Komşu yüzler iki tonla ayrılır:
+// taban, sağ ve arka yüz dark, ön ve sol yüz light.
+constexpr VertexArray<18> pyramid(Point3 lo, Point3 hi, Point3 apex, Point3 dark, Point3 light)
+{
+    const Point3 a = {lo.x, lo.y, lo.z}, b = {hi.x, lo.y, lo.z}, c = {hi.x, lo.y, hi.z}, d = {lo.x, lo.y, hi.z};
+    const Point3 center = {(lo.x + hi.x) * 0.5f, lo.y, (lo.z + hi.z) * 0.5f};
+
+    VertexArray<18> out{};
+    size_t i = 0;
+    auto triangle = [&](Point3 p0, Point3 p1, Point3 p2, Point3 normal, Point3 color)
+    {
+        putVertex(out, i, p0, normal, color);
+        putVertex(out, i, p1, normal, color);
+        putVertex(out, i, p2, normal, color);
+    };
+    triangle(b, a, d, {0.0f, -1.0f, 0.0f}, dark); // Taban
+    triangle(b, d, c, {0.0f, -1.0f, 0.0f}, dark);
+    triangle(apex, c, d, outwardNormal(apex, c, d, center), light); // Ön
+    triangle(apex, b, c, outwardNormal(apex, b, c, center), dark);  // Sağ
+    triangle(apex, d, a, outwardNormal(apex, d, a, center), light); // Sol
+    triangle(apex, a, b, outwardNormal(apex, a, b, center), dark);  // Arka
+    return out;
+}
+
+#endif
@@ -0,0 +1,546 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "culling.h"
+#include "frustum.h"
+
+// Sahne nesneleri üzerinde sınır hacmi hiyerarşisi (BVH). Görüş hacmi
+// ayıklaması, ışın seçimi (picking) ve bölge sorguları (ör. ışık ataması)
+// nesne sayısıyla doğrusal değil, ağacın derinliğiyle ölçeklenir.
+//  - build(): kutu başına bölmeli (binned) SAH; her düğümde nesne
+//    merkezleri BVH_BINS kovaya dağıtılır, kovalar arasındaki en ucuz kesim
+//    seçilir.
+//  - update() + refit(): hareket eden nesnenin sadece yaprağından köke giden
+//    yol yeniden sığdırılır. Yüzey alanı kurulduğu andakinin BVH_REBUILD_RATIO
+//    katını aşan alt ağaç yerinde yeniden kurulur (kısmi yeniden kurma);
+//    bütün ağaç sadece terk edilen düğümler çoğalınca baştan kurulur.
+// Nesne kimlikleri build()'e verilen dizideki indekslerdir.
+const int BVH_BINS = 12;
+const uint32_t BVH_MAX_LEAF_ITEMS = 4;
+const float BVH_TRAVERSAL_COST = 1.0f; // Bir düğüm ziyaretinin nesne testine göre maliyeti
+const float BVH_REBUILD_RATIO = 1.5f;
+
+struct BvhNode
+{
+    glm::vec3 boundsMin;
+    uint32_t first; // İç düğüm: sol çocuk (sağ = first + 1); yaprak: itemOrder'daki ilk nesne
+    glm::vec3 boundsMax;
+    uint32_t count; // Yaprağın nesne sayısı; 0 = iç düğüm
+    uint32_t parent;
+    float builtArea; // Kurulduğu andaki yüzey alanı (bozulma ölçüsü)
+};
+
+class Bvh
+{
+public:
+    static constexpr uint32_t NONE = 0xffffffffu;
+
+    void build(const std::vector<ObjectBounds> &bounds)
+    {
+        items = bounds;
+        itemOrder.resize(items.size());
+        itemLeaf.assign(items.size(), NONE);
+        for (uint32_t i = 0; i < (uint32_t)items.size(); ++i)
+            itemOrder[i] = i;
+        rebuildAll();
+    }
+
+    size_t itemCount() const
+    {
+        return items.size();
+    }
+
+    size_t nodeCount() const
+    {
+        return nodes.size() - abandonedNodes;
+    }
+
+    size_t partialRebuildCount() const
+    {
+        return partialRebuilds;
+    }
+
+    const ObjectBounds &itemBounds(uint32_t item) const
+    {
+        return items[item];
+    }
+
+    // Ağacın düğümleri (kök 0) ve yaprakların itemOrder'daki nesneleri;
+    // ağacı gezip doğrulamak içindir
+    const BvhNode &node(uint32_t index) const
+    {
+        return nodes[index];
+    }
+
+    uint32_t leafItem(uint32_t position) const
+    {
+        return itemOrder[position];
+    }
+
+    // Nesnenin yeni sınırları; ağaç refit() çağrılana kadar eski halinde kalır
+    void update(uint32_t item, const ObjectBounds &bounds)
+    {
+        items[item] = bounds;
+        dirtyLeaves.push_back(itemLeaf[item]);
+    }
+
+    // update() edilen yaprakları ve köke kadar atalarını yeniden sığdırır;
+    // bozulan en yüksek alt ağaçları yeniden kurar
+    void refit()
+    {
+        if (dirtyLeaves.empty())
+            return;
+        std::sort(dirtyLeaves.begin(), dirtyLeaves.end());
+        dirtyLeaves.erase(std::unique(dirtyLeaves.begin(), dirtyLeaves.end()), dirtyLeaves.end());
+
+        std::vector<uint32_t> degraded;
+        for (uint32_t leaf : dirtyLeaves)
+        {
+            uint32_t worst = NONE;
+            for (uint32_t node = leaf; node != NONE; node = nodes[node].parent)
+            {
+                const bool changed = fitNode(node);
+                if (surfaceArea(nodes[node].boundsMin, nodes[node].boundsMax) > nodes[node].builtArea * BVH_REBUILD_RATIO)
+                    worst = node;
+                if (!changed && node != leaf)
+                    break;
+            }
+            if (worst != NONE)
+                degraded.push_back(worst);
+        }
+        dirtyLeaves.clear();
+
+        // Alt ağaçlardan biri diğerini içeriyorsa sadece üsttekini kur:
+        // düşük indeksli düğüm her zaman atadır (çocuklar ebeveynden sonra ayrılır)
+        std::sort(degraded.begin(), degraded.end());
+        degraded.erase(std::unique(degraded.begin(), degraded.end()), degraded.end());
+        std::vector<uint32_t> roots;
+        for (uint32_t node : degraded)
+        {
+            bool covered = false;
+            for (uint32_t ancestor = nodes[node].parent; ancestor != NONE && !covered; ancestor = nodes[ancestor].parent)
+                covered = std::binary_search(degraded.begin(), degraded.end(), ancestor);
+            if (!covered)
+                roots.push_back(node);
+        }
+        for (uint32_t node : roots)
+            rebuildSubtree(node);
+
+        if (abandonedNodes > nodes.size() / 2)
+            rebuildAll();
+    }
+
+    // Görüş hacmiyle kesişebilen her nesne için visit(item). Düğüm bir düzlemin
+    // tamamen içindeyse o düzlem alt ağaçta bir daha test edilmez; bütün
+    // düzlemlerin içindeki alt ağacın nesneleri testsiz ziyaret edilir.
+    template <class Fn>
+    void cull(const Frustum &frustum, Fn visit) const
+    {
+        if (nodes.empty())
+            return;
+        struct Entry
+        {
+            uint32_t node;
+            uint32_t planeMask;
+        };
+        std::vector<Entry> stack;
+        stack.reserve(64);
+        stack.push_back({0, 0x3f});
+        while (!stack.empty())
+        {
+            const Entry entry = stack.back();
+            stack.pop_back();
+            const BvhNode &node = nodes[entry.node];
+            uint32_t mask = entry.planeMask;
+            if (!testBox(frustum, node.boundsMin, node.boundsMax, mask))
+                continue;
+
+            if (node.count > 0)
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    const uint32_t item = itemOrder[i];
+                    uint32_t itemMask = mask;
+                    if (mask == 0 || (testBox(frustum, items[item].boundsMin, items[item].boundsMax, itemMask) &&
+                                      testSphere(frustum, items[item].center, items[item].radius, itemMask)))
+                        visit(item);
+                }
+            }
+            else
+            {
+                stack.push_back({node.first + 1, mask});
+                stack.push_back({node.first, mask});
+            }
+        }
+    }
+
+    // Işının (origin + t * direction, t >= 0) sınır kutusuna ilk çarptığı
+    // nesne; yakın çocuk önce ziyaret edilir, daha uzaktaki düğümler budanır.
+    // Nesne düzeyinde seçim içindir; üçgen testi çağırana kalır.
+    bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, uint32_t &hitItem, float &hitDistance) const
+    {
+        hitItem = NONE;
+        hitDistance = std::numeric_limits<float>::max();
+        if (nodes.empty())
+            return false;
+
+        const glm::vec3 inverse = 1.0f / direction;
+        std::vector<uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(0);
+        while (!stack.empty())
+        {
+            const BvhNode &node = nodes[stack.back()];
+            stack.pop_back();
+            float entry;
+            if (!rayBox(origin, inverse, node.boundsMin, node.boundsMax, entry) || entry >= hitDistance)
+                continue;
+
+            if (node.count > 0)
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    const uint32_t item = itemOrder[i];
+                    if (rayBox(origin, inverse, items[item].boundsMin, items[item].boundsMax, entry) && entry < hitDistance)
+                    {
+                        hitDistance = entry;
+                        hitItem = item;
+                    }
+                }
+            }
+            else
+            {
+                float leftEntry, rightEntry;
+                const bool left = rayBox(origin, inverse, nodes[node.first].boundsMin, nodes[node.first].boundsMax, leftEntry);
+                const bool right = rayBox(origin, inverse, nodes[node.first + 1].boundsMin, nodes[node.first + 1].boundsMax, rightEntry);
+                // Yakın olan en son itilir, önce o çıkar
+                if (left && right && leftEntry < rightEntry)
+                {
+                    stack.push_back(node.first + 1);
+                    stack.push_back(node.first);
+                }
+                else
+                {
+                    if (left)
+                        stack.push_back(node.first);
+                    if (right)
+                        stack.push_back(node.first + 1);
+                }
+            }
+        }
+        return hitItem != NONE;
+    }
+
+    // Sınır kutusu [boundsMin, boundsMax] ile kesişen her nesne için visit(item)
+    template <class Fn>
+    void overlap(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, Fn visit) const
+    {
+        if (nodes.empty())
+            return;
+        std::vector<uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(0);
+        while (!stack.empty())
+        {
+            const BvhNode &node = nodes[stack.back()];
+            stack.pop_back();
+            if (!boxesOverlap(node.boundsMin, node.boundsMax, boundsMin, boundsMax))
+                continue;
+            if (node.count > 0)
+            {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i)
+                {
+                    const uint32_t item = itemOrder[i];
+                    if (boxesOverlap(items[item].boundsMin, items[item].boundsMax, boundsMin, boundsMax))
+                        visit(item);
+                }
+            }
+            else
+            {
+                stack.push_back(node.first);
+                stack.push_back(node.first + 1);
+            }
+        }
+    }
+
+    // Ağacın SAH maliyeti, kök alanına göre: sum(iç düğüm alanı * gezinme) +
+    // sum(yaprak alanı * nesne sayısı). Refit'lerle ne kadar bozulduğunu gösterir.
+    float sahCost() const
+    {
+        if (nodes.empty())
+            return 0.0f;
+        float cost = 0.0f;
+        std::vector<uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(0);
+        while (!stack.empty())
+        {
+            const BvhNode &node = nodes[stack.back()];
+            stack.pop_back();
+            const float area = surfaceArea(node.boundsMin, node.boundsMax);
+            if (node.count > 0)
+                cost += area * node.count;
+            else
+            {
+                cost += area * BVH_TRAVERSAL_COST;
+                stack.push_back(node.first);
+                stack.push_back(node.first + 1);
+            }
+        }
+        const float rootArea = surfaceArea(nodes[0].boundsMin, nodes[0].boundsMax);
+        return rootArea > 0.0f ? cost / rootArea : 0.0f;
+    }
+
+private:
+    static float surfaceArea(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+    {
+        const glm::vec3 e = glm::max(boundsMax - boundsMin, glm::vec3(0.0f));
+        return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+    }
+
+    static bool boxesOverlap(const glm::vec3 &aMin, const glm::vec3 &aMax, const glm::vec3 &bMin, const glm::vec3 &bMax)
+    {
+        return aMin.x <= bMax.x && aMax.x >= bMin.x && aMin.y <= bMax.y && aMax.y >= bMin.y && aMin.z <= bMax.z &&
+               aMax.z >= bMin.z;
+    }
+
+    // Slab testi; entry ışının kutuya girdiği t (içerideyse 0)
+    static bool rayBox(const glm::vec3 &origin, const glm::vec3 &inverse, const glm::vec3 &boundsMin,
+                       const glm::vec3 &boundsMax, float &entry)
+    {
+        const glm::vec3 t0 = (boundsMin - origin) * inverse;
+        const glm::vec3 t1 = (boundsMax - origin) * inverse;
+        const glm::vec3 tMin = glm::min(t0, t1), tMax = glm::max(t0, t1);
+        entry = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+        const float exit = std::min(std::min(tMax.x, tMax.y), tMax.z);
+        return entry <= exit;
+    }
+
+    // mask'teki düzlemlere karşı kutu testi; kutunun tamamen içinde kaldığı
+    // düzlemler maskeden çıkar. Bir düzlemin tamamen dışındaysa false.
+    static bool testBox(const Frustum &frustum, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, uint32_t &mask)
+    {
+        const glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+        const glm::vec3 extent = (boundsMax - boundsMin) * 0.5f;
+        for (int p = 0; p < 6; ++p)
+        {
+            if (!(mask & (1u << p)))
+                continue;
+            const glm::vec4 &plane = frustum.planes[p];
+            const float distance = glm::dot(glm::vec3(plane), center) + plane.w;
+            const float reach = glm::dot(glm::abs(glm::vec3(plane)), extent);
+            if (distance + reach < 0.0f)
+                return false;
+            if (distance - reach >= 0.0f)
+                mask &= ~(1u << p);
+        }
+        return true;
+    }
+
+    static bool testSphere(const Frustum &frustum, const glm::vec3 &center, float radius, uint32_t mask)
+    {
+        for (int p = 0; p < 6; ++p)
+        {
+            const glm::vec4 &plane = frustum.planes[p];
+            if ((mask & (1u << p)) && glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    // Yaprağı nesnelerinden, iç düğümü çocuklarından sığdırır; değiştiyse true
+    bool fitNode(uint32_t index)
+    {
+        BvhNode &node = nodes[index];
+        glm::vec3 boundsMin(std::numeric_limits<float>::max()), boundsMax(-std::numeric_limits<float>::max());
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                boundsMin = glm::min(boundsMin, items[itemOrder[i]].boundsMin);
+                boundsMax = glm::max(boundsMax, items[itemOrder[i]].boundsMax);
+            }
+        }
+        else
+        {
+            boundsMin = glm::min(nodes[node.first].boundsMin, nodes[node.first + 1].boundsMin);
+            boundsMax = glm::max(nodes[node.first].boundsMax, nodes[node.first + 1].boundsMax);
+        }
+        const bool changed = boundsMin != node.boundsMin || boundsMax != node.boundsMax;
+        node.boundsMin = boundsMin;
+        node.boundsMax = boundsMax;
+        return changed;
+    }
+
+    void rebuildAll()
+    {
+        nodes.clear();
+        abandonedNodes = 0;
+        if (items.empty())
+            return;
+        nodes.reserve(items.size() * 2);
+        nodes.push_back(BvhNode());
+        buildNode(0, NONE, 0, (uint32_t)items.size());
+    }
+
+    // Alt ağacın nesneleri itemOrder'da ardışıktır (kurma aralıkları bölerek
+    // ilerler); aralık en soldaki ve en sağdaki yapraktan bulunur. Kök aynı
+    // yerde kalır, yeni çocuklar dizinin sonuna eklenir, eskileri terk edilir.
+    void rebuildSubtree(uint32_t index)
+    {
+        uint32_t leftmost = index, rightmost = index;
+        while (nodes[leftmost].count == 0)
+            leftmost = nodes[leftmost].first;
+        while (nodes[rightmost].count == 0)
+            rightmost = nodes[rightmost].first + 1;
+        const uint32_t begin = nodes[leftmost].first;
+        const uint32_t end = nodes[rightmost].first + nodes[rightmost].count;
+
+        abandonedNodes += subtreeSize(index) - 1;
+        buildNode(index, nodes[index].parent, begin, end);
+        ++partialRebuilds;
+    }
+
+    size_t subtreeSize(uint32_t index) const
+    {
+        return nodes[index].count > 0 ? 1 : 1 + subtreeSize(nodes[index].first) + subtreeSize(nodes[index].first + 1);
+    }
+
+    void buildNode(uint32_t index, uint32_t parent, uint32_t begin, uint32_t end)
+    {
+        glm::vec3 boundsMin(std::numeric_limits<float>::max()), boundsMax(-std::numeric_limits<float>::max());
+        glm::vec3 centroidMin = boundsMin, centroidMax = boundsMax;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const ObjectBounds &item = items[itemOrder[i]];
+            boundsMin = glm::min(boundsMin, item.boundsMin);
+            boundsMax = glm::max(boundsMax, item.boundsMax);
+            const glm::vec3 centroid = (item.boundsMin + item.boundsMax) * 0.5f;
+            centroidMin = glm::min(centroidMin, centroid);
+            centroidMax = glm::max(centroidMax, centroid);
+        }
+        const uint32_t count = end - begin;
+        const float area = surfaceArea(boundsMin, boundsMax);
+        {
+            BvhNode &node = nodes[index];
+            node.boundsMin = boundsMin;
+            node.boundsMax = boundsMax;
+            node.parent = parent;
+            node.builtArea = area;
+            node.first = begin;
+            node.count = count;
+        }
+        for (uint32_t i = begin; i < end; ++i)
+            itemLeaf[itemOrder[i]] = index;
+        if (count <= 1)
+            return;
+
+        // En ucuz kesim: her eksende kovalar soldan ve sağdan taranır
+        int bestAxis = -1, bestBin = 0;
+        float bestCost = std::numeric_limits<float>::max();
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float extent = centroidMax[axis] - centroidMin[axis];
+            if (extent <= 0.0f)
+                continue;
+            struct Bin
+            {
+                glm::vec3 boundsMin = glm::vec3(std::numeric_limits<float>::max());
+                glm::vec3 boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+                uint32_t count = 0;
+            } bins[BVH_BINS];
+            const float scale = BVH_BINS / extent;
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const ObjectBounds &item = items[itemOrder[i]];
+                Bin &bin = bins[binIndex((item.boundsMin[axis] + item.boundsMax[axis]) * 0.5f, centroidMin[axis], scale)];
+                bin.boundsMin = glm::min(bin.boundsMin, item.boundsMin);
+                bin.boundsMax = glm::max(bin.boundsMax, item.boundsMax);
+                ++bin.count;
+            }
+
+            float rightArea[BVH_BINS];
+            uint32_t rightCount[BVH_BINS];
+            glm::vec3 sweepMin(std::numeric_limits<float>::max()), sweepMax(-std::numeric_limits<float>::max());
+            uint32_t sweepCount = 0;
+            for (int b = BVH_BINS - 1; b > 0; --b)
+            {
+                sweepMin = glm::min(sweepMin, bins[b].boundsMin);
+                sweepMax = glm::max(sweepMax, bins[b].boundsMax);
+                sweepCount += bins[b].count;
+                rightArea[b] = surfaceArea(sweepMin, sweepMax);
+                rightCount[b] = sweepCount;
+            }
+            sweepMin = glm::vec3(std::numeric_limits<float>::max());
+            sweepMax = glm::vec3(-std::numeric_limits<float>::max());
+            sweepCount = 0;
+            for (int b = 0; b < BVH_BINS - 1; ++b)
+            {
+                sweepMin = glm::min(sweepMin, bins[b].boundsMin);
+                sweepMax = glm::max(sweepMax, bins[b].boundsMax);
+                sweepCount += bins[b].count;
+                if (sweepCount == 0 || rightCount[b + 1] == 0)
+                    continue;
+                const float cost = surfaceArea(sweepMin, sweepMax) * sweepCount + rightArea[b + 1] * rightCount[b + 1];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b + 1;
+                }
+            }
+        }
+
+        // Bölmek yaprak kalmaktan pahalıysa (ve yaprak sınırı aşılmıyorsa) dur
+        const float leafCost = area * count;
+        const float splitCost = BVH_TRAVERSAL_COST * area + bestCost;
+        if (count <= BVH_MAX_LEAF_ITEMS && (bestAxis < 0 || splitCost >= leafCost))
+            return;
+
+        uint32_t *first = itemOrder.data() + begin, *last = itemOrder.data() + end;
+        uint32_t *middle;
+        if (bestAxis >= 0)
+        {
+            const float scale = BVH_BINS / (centroidMax[bestAxis] - centroidMin[bestAxis]);
+            middle = std::partition(first, last, [&](uint32_t item)
+                                    { return binIndex((items[item].boundsMin[bestAxis] + items[item].boundsMax[bestAxis]) * 0.5f,
+                                                      centroidMin[bestAxis], scale) < bestBin; });
+        }
+        else
+        {
+            // Bütün merkezler üst üste: ortadan böl
+            middle = first + count / 2;
+        }
+        const uint32_t split = (uint32_t)(middle - itemOrder.data());
+
+        const uint32_t left = (uint32_t)nodes.size();
+        nodes.resize(nodes.size() + 2);
+        nodes[index].first = left;
+        nodes[index].count = 0;
+        buildNode(left, index, begin, split);
+        buildNode(left + 1, index, split, end);
+    }
+
+    static int binIndex(float centroid, float origin, float scale)
+    {
+        return std::min(BVH_BINS - 1, std::max(0, (int)((centroid - origin) * scale)));
+    }
+
+    std::vector<ObjectBounds> items;
+    std::vector<uint32_t> itemOrder; // Yaprakların nesne aralıkları bu dizide
+    std::vector<uint32_t> itemLeaf;  // Nesnenin bulunduğu yaprak
+    std::vector<BvhNode> nodes;      // 0 kök; çocuklar her zaman ebeveynden sonra
+    std::vector<uint32_t> dirtyLeaves;
+    size_t abandonedNodes = 0;
+    size_t partialRebuilds = 0;
+};
+
+#endif
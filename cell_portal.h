@@ -0,0 +1,286 @@
+#ifndef CELL_PORTAL_H
+#define CELL_PORTAL_H
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "frustum.h"
+
+// Hücre/portal görünürlüğü: odalar eksen hizalı kutularla tanımlanan
+// hücreler, kapı boşlukları iki hücreyi bağlayan dışbükey portal
+// çokgenleridir. Her karede kameranın bulunduğu hücreden başlanır; görüş
+// hacmi her görünen portaldan geçerken portal çokgeni o anki düzlemlere göre
+// kırpılır ve kalan çokgenin kenarlarıyla kameradan geçen yan düzlemler yeni,
+// daha dar bir hacim kurar. Hacim boşalan portalın arkasına geçilmez; böylece
+// karenin maliyeti binanın büyüklüğüyle değil, görünen odalarla artar.
+// Kamera hiçbir hücrede değilse (ör. binanın dışında) sistem devre dışıdır ve
+// her şey görünür sayılır.
+const size_t PORTAL_NO_CELL = (size_t)-1;
+const int PORTAL_MAX_DEPTH = 16;
+// Kamera portal düzlemine bundan yakınsa (kapı eşiğinde) hacim daraltılmadan geçer
+const float PORTAL_PLANE_EPSILON = 0.05f;
+
+// Son update()'in sayaçları
+struct PortalStats
+{
+    size_t cells = 0;
+    size_t visibleCells = 0;
+    size_t views = 0;         // Hücreye ulaşan portal zincirleri (kök dahil)
+    size_t portalsTested = 0; // Kırpılan portal çokgenleri
+};
+
+class CellPortalGraph
+{
+public:
+    // Hücrenin indeksini döndürür; hücreler birbirine değebilir, noktanın
+    // hücresi eklenme sırasına göre ilk bulunan kutudur
+    size_t addCell(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+    {
+        Cell cell;
+        cell.boundsMin = boundsMin;
+        cell.boundsMax = boundsMax;
+        cells.push_back(cell);
+        cellVisibleFlags.push_back(0);
+        return cells.size() - 1;
+    }
+
+    // İki hücre arasındaki dışbükey çokgen (dünya uzayı, sıralı köşeler)
+    void addPortal(size_t cellA, size_t cellB, const std::vector<glm::vec3> &polygon)
+    {
+        Portal portal;
+        portal.cells[0] = cellA;
+        portal.cells[1] = cellB;
+        portal.polygon = polygon;
+        portals.push_back(portal);
+        onPath.push_back(0);
+        cells[cellA].portals.push_back(portals.size() - 1);
+        cells[cellB].portals.push_back(portals.size() - 1);
+    }
+
+    size_t cellCount() const
+    {
+        return cells.size();
+    }
+
+    size_t cellAt(const glm::vec3 &point) const
+    {
+        for (size_t c = 0; c < cells.size(); ++c)
+        {
+            const Cell &cell = cells[c];
+            if (glm::all(glm::greaterThanEqual(point, cell.boundsMin)) && glm::all(glm::lessThanEqual(point, cell.boundsMax)))
+                return c;
+        }
+        return PORTAL_NO_CELL;
+    }
+
+    // Bu karenin görünen hücrelerini ve her birinin portal hacimlerini kurar
+    void update(const glm::vec3 &cameraPos, const Frustum &frustum)
+    {
+        this->cameraPos = cameraPos;
+        farPlane = frustum.planes[5];
+        views.clear();
+        planes.clear();
+        visibleCellList.clear();
+        for (uint8_t &flag : cellVisibleFlags)
+            flag = 0;
+        stats = PortalStats();
+        stats.cells = cells.size();
+
+        cameraCell = cellAt(cameraPos);
+        if (cameraCell == PORTAL_NO_CELL)
+            return;
+
+        const size_t root = planes.size();
+        planes.insert(planes.end(), frustum.planes, frustum.planes + 6);
+        visit(cameraCell, root, 6, 0);
+        stats.visibleCells = visibleCellList.size();
+        stats.views = views.size();
+    }
+
+    // Kamera bir hücrede mi (değilse portal ayıklaması yapılmaz)
+    bool active() const
+    {
+        return cameraCell != PORTAL_NO_CELL;
+    }
+
+    bool cellVisible(size_t cell) const
+    {
+        return !active() || cellVisibleFlags[cell];
+    }
+
+    // Bu karede ulaşılan hücreler, ulaşılma sırasıyla
+    const std::vector<size_t> &visibleCells() const
+    {
+        return visibleCellList;
+    }
+
+    // Kutu hücreye ulaşan hacimlerden en az birinin içindeyse görünür
+    bool visible(size_t cell, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) const
+    {
+        if (!active() || cell == PORTAL_NO_CELL)
+            return true;
+        if (!cellVisibleFlags[cell])
+            return false;
+        for (const View &view : views)
+        {
+            if (view.cell == cell && boxInside(view, boundsMin, boundsMax))
+                return true;
+        }
+        return false;
+    }
+
+    // Hücresi kutunun merkezinden bulunur; hiçbir hücrede olmayan kutu görünür
+    bool visible(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) const
+    {
+        if (!active())
+            return true;
+        return visible(cellAt((boundsMin + boundsMax) * 0.5f), boundsMin, boundsMax);
+    }
+
+    const PortalStats &portalStats() const
+    {
+        return stats;
+    }
+
+private:
+    struct Cell
+    {
+        glm::vec3 boundsMin, boundsMax;
+        std::vector<size_t> portals;
+    };
+
+    struct Portal
+    {
+        size_t cells[2];
+        std::vector<glm::vec3> polygon;
+    };
+
+    // Bir hücreye bir portal zinciriyle ulaşan hacim: planes[firstPlane, firstPlane + planeCount)
+    struct View
+    {
+        size_t cell;
+        size_t firstPlane;
+        size_t planeCount;
+    };
+
+    static float distance(const glm::vec4 &plane, const glm::vec3 &p)
+    {
+        return glm::dot(glm::vec3(plane), p) + plane.w;
+    }
+
+    bool boxInside(const View &view, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) const
+    {
+        const glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+        const glm::vec3 extent = (boundsMax - boundsMin) * 0.5f;
+        for (size_t p = view.firstPlane; p < view.firstPlane + view.planeCount; ++p)
+        {
+            const glm::vec4 &plane = planes[p];
+            if (distance(plane, center) + glm::dot(glm::abs(glm::vec3(plane)), extent) < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    // Hücreyi hacmiyle kaydeder, yoldaki olmayan portallarından geçer
+    void visit(size_t cell, size_t firstPlane, size_t planeCount, int depth)
+    {
+        View view;
+        view.cell = cell;
+        view.firstPlane = firstPlane;
+        view.planeCount = planeCount;
+        views.push_back(view);
+        if (!cellVisibleFlags[cell])
+        {
+            cellVisibleFlags[cell] = 1;
+            visibleCellList.push_back(cell);
+        }
+        if (depth >= PORTAL_MAX_DEPTH)
+            return;
+
+        for (size_t p : cells[cell].portals)
+        {
+            if (onPath[p])
+                continue;
+            const Portal &portal = portals[p];
+            const size_t next = portal.cells[0] == cell ? portal.cells[1] : portal.cells[0];
+            ++stats.portalsTested;
+
+            // Çokgen o anki hacmin düzlemlerine göre kırpılır (Sutherland-Hodgman)
+            std::vector<glm::vec3> polygon = portal.polygon, clipped;
+            for (size_t i = firstPlane; i < firstPlane + planeCount && polygon.size() >= 3; ++i)
+            {
+                const glm::vec4 plane = planes[i];
+                clipped.clear();
+                for (size_t k = 0; k < polygon.size(); ++k)
+                {
+                    const glm::vec3 &a = polygon[k], &b = polygon[(k + 1) % polygon.size()];
+                    const float da = distance(plane, a), db = distance(plane, b);
+                    if (da >= 0.0f)
+                        clipped.push_back(a);
+                    if ((da >= 0.0f) != (db >= 0.0f))
+                        clipped.push_back(a + (b - a) * (da / (da - db)));
+                }
+                polygon.swap(clipped);
+            }
+            if (polygon.size() < 3)
+                continue;
+
+            onPath[p] = 1;
+            const glm::vec3 normal = glm::cross(portal.polygon[1] - portal.polygon[0], portal.polygon[2] - portal.polygon[0]);
+            const float side = glm::dot(glm::normalize(normal), cameraPos - portal.polygon[0]);
+            if (std::abs(side) < PORTAL_PLANE_EPSILON)
+            {
+                // Kapı eşiğinde: kameradan geçen yan düzlemler bozulur, hacim aynen geçer
+                visit(next, firstPlane, planeCount, depth + 1);
+            }
+            else
+            {
+                const size_t first = planes.size();
+                addPortalPlanes(polygon, glm::normalize(normal) * (side > 0.0f ? -1.0f : 1.0f));
+                visit(next, first, planes.size() - first, depth + 1);
+            }
+            onPath[p] = 0;
+        }
+    }
+
+    // Kırpılmış çokgenden yeni hacim: her kenar için kameradan geçen yan
+    // düzlem, portalın kendi düzlemi (arkası) ve kök hacmin uzak düzlemi
+    void addPortalPlanes(const std::vector<glm::vec3> &polygon, const glm::vec3 &awayNormal)
+    {
+        glm::vec3 centroid(0.0f);
+        for (const glm::vec3 &p : polygon)
+            centroid += p;
+        centroid /= (float)polygon.size();
+
+        for (size_t k = 0; k < polygon.size(); ++k)
+        {
+            glm::vec3 n = glm::cross(polygon[k] - cameraPos, polygon[(k + 1) % polygon.size()] - cameraPos);
+            const float length = glm::length(n);
+            if (length < 1e-6f)
+                continue; // Kırpmadan kalan çakışık köşeler
+            n /= length;
+            if (glm::dot(n, centroid - cameraPos) < 0.0f)
+                n = -n;
+            planes.push_back(glm::vec4(n, -glm::dot(n, cameraPos)));
+        }
+        planes.push_back(glm::vec4(awayNormal, -glm::dot(awayNormal, polygon[0])));
+        planes.push_back(farPlane);
+    }
+
+    std::vector<Cell> cells;
+    std::vector<Portal> portals;
+    std::vector<uint8_t> onPath;           // Portal o anki zincirde mi
+    std::vector<uint8_t> cellVisibleFlags; // Hücre bu karede ulaşıldı mı
+    std::vector<size_t> visibleCellList;
+    std::vector<View> views;
+    std::vector<glm::vec4> planes;
+    glm::vec3 cameraPos = glm::vec3(0.0f);
+    glm::vec4 farPlane = glm::vec4(0.0f);
+    size_t cameraCell = PORTAL_NO_CELL;
+    PortalStats stats;
+};
+
+#endif
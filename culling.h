@@ -0,0 +1,232 @@
+#ifndef CULLING_H
+#define CULLING_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CULLING_SSE 1
+#endif
+
+#include "frustum.h"
+
+// Nesne başına dünya uzayı sınırları ve görüş hacmi ayıklaması. Her nesne
+// hem eksen hizalı sınır kutusu (AABB) hem sınır küresi taşır: küre tek
+// çarpma-toplamayla kaba eler, kutu uzun ince nesnelerde (duvar, masa) daha
+// sıkıdır. CullingSet sınırları yapı dizisi yerine dizi yapısı (SoA) olarak
+// tutar; SSE varsa her düzlem testi dört nesneye birden uygulanır.
+
+struct ObjectBounds
+{
+    glm::vec3 boundsMin = glm::vec3(0.0f);
+    glm::vec3 boundsMax = glm::vec3(0.0f);
+    glm::vec3 center = glm::vec3(0.0f); // Sınır küresi
+    float radius = 0.0f;
+};
+
+// Kare başına ayıklama sayaçları (nesneler ve kümeleri)
+struct CullStats
+{
+    size_t objects = 0;
+    size_t visibleObjects = 0;
+    size_t occludedObjects = 0; // Görüş hacminde ama örtücülerin arkasında
+    size_t clusters = 0;
+    size_t visibleClusters = 0;
+};
+
+// Noktaları kapsayan sınırlar: küre merkezi kutunun merkezi, yarıçap en uzak
+// noktaya uzaklık. stride float'lık kayıtların ilk üçü pozisyondur.
+inline ObjectBounds computeBounds(const float *data, size_t pointCount, size_t stride)
+{
+    ObjectBounds bounds;
+    if (pointCount == 0)
+        return bounds;
+    bounds.boundsMin = glm::vec3(std::numeric_limits<float>::max());
+    bounds.boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+    for (size_t i = 0; i < pointCount; ++i)
+    {
+        const glm::vec3 p(data[i * stride], data[i * stride + 1], data[i * stride + 2]);
+        bounds.boundsMin = glm::min(bounds.boundsMin, p);
+        bounds.boundsMax = glm::max(bounds.boundsMax, p);
+    }
+    bounds.center = (bounds.boundsMin + bounds.boundsMax) * 0.5f;
+    for (size_t i = 0; i < pointCount; ++i)
+    {
+        const glm::vec3 p(data[i * stride], data[i * stride + 1], data[i * stride + 2]);
+        bounds.radius = std::max(bounds.radius, glm::length(p - bounds.center));
+    }
+    return bounds;
+}
+
+// Sadece kutusu bilinen nesne: küre kutuyu çevreler
+inline ObjectBounds boxBounds(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+{
+    ObjectBounds bounds;
+    bounds.boundsMin = boundsMin;
+    bounds.boundsMax = boundsMax;
+    bounds.center = (boundsMin + boundsMax) * 0.5f;
+    bounds.radius = glm::length(boundsMax - boundsMin) * 0.5f;
+    return bounds;
+}
+
+// Model uzayı sınırlarını dünyaya taşır: kutu Arvo'nun yöntemiyle (yeni yarı
+// boyutlar |M| * eski yarı boyutlar), küre en büyük eksen ölçeğiyle
+inline ObjectBounds transformBounds(const ObjectBounds &bounds, const glm::mat4 &model)
+{
+    const glm::mat3 linear(model);
+    glm::mat3 absolute;
+    for (int c = 0; c < 3; ++c)
+        absolute[c] = glm::abs(linear[c]);
+    const glm::vec3 center = glm::vec3(model * glm::vec4((bounds.boundsMin + bounds.boundsMax) * 0.5f, 1.0f));
+    const glm::vec3 extent = absolute * ((bounds.boundsMax - bounds.boundsMin) * 0.5f);
+
+    ObjectBounds world;
+    world.boundsMin = center - extent;
+    world.boundsMax = center + extent;
+    world.center = glm::vec3(model * glm::vec4(bounds.center, 1.0f));
+    world.radius = bounds.radius * std::max(glm::length(linear[0]), std::max(glm::length(linear[1]), glm::length(linear[2])));
+    return world;
+}
+
+// SoA sınır kümesi. Diziler 4'ün katına doldurulur; SIMD döngüsü kuyruk
+// durumu olmadan ilerler.
+class CullingSet
+{
+public:
+    void clear()
+    {
+        count = 0;
+        for (std::vector<float> *array : arrays())
+            array->clear();
+    }
+
+    // Nesneyi ekler, indeksini döndürür
+    size_t add(const ObjectBounds &bounds)
+    {
+        const size_t index = count++;
+        const size_t padded = (count + 3) & ~(size_t)3;
+        for (std::vector<float> *array : arrays())
+            array->resize(padded, 0.0f);
+        set(index, bounds);
+        return index;
+    }
+
+    void set(size_t index, const ObjectBounds &bounds)
+    {
+        const glm::vec3 center = (bounds.boundsMin + bounds.boundsMax) * 0.5f;
+        const glm::vec3 extent = (bounds.boundsMax - bounds.boundsMin) * 0.5f;
+        boxCenterX[index] = center.x;
+        boxCenterY[index] = center.y;
+        boxCenterZ[index] = center.z;
+        extentX[index] = extent.x;
+        extentY[index] = extent.y;
+        extentZ[index] = extent.z;
+        sphereX[index] = bounds.center.x;
+        sphereY[index] = bounds.center.y;
+        sphereZ[index] = bounds.center.z;
+        radius[index] = bounds.radius;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    // visible[i] = 1 ise i. nesne görüş hacmiyle kesişebilir. Bir düzlemin
+    // tamamen dışında kalan küre ya da kutu nesneyi eler.
+    void cull(const Frustum &frustum, std::vector<uint8_t> &visible) const
+    {
+#ifdef CULLING_SSE
+        visible.resize(count);
+        __m128 planeX[6], planeY[6], planeZ[6], planeW[6], absX[6], absY[6], absZ[6];
+        for (int p = 0; p < 6; ++p)
+        {
+            const glm::vec4 &plane = frustum.planes[p];
+            planeX[p] = _mm_set1_ps(plane.x);
+            planeY[p] = _mm_set1_ps(plane.y);
+            planeZ[p] = _mm_set1_ps(plane.z);
+            planeW[p] = _mm_set1_ps(plane.w);
+            absX[p] = _mm_set1_ps(std::abs(plane.x));
+            absY[p] = _mm_set1_ps(std::abs(plane.y));
+            absZ[p] = _mm_set1_ps(std::abs(plane.z));
+        }
+        const __m128 zero = _mm_setzero_ps();
+
+        for (size_t i = 0; i < count; i += 4)
+        {
+            const __m128 sx = _mm_loadu_ps(&sphereX[i]), sy = _mm_loadu_ps(&sphereY[i]), sz = _mm_loadu_ps(&sphereZ[i]);
+            const __m128 r = _mm_loadu_ps(&radius[i]);
+            const __m128 bx = _mm_loadu_ps(&boxCenterX[i]), by = _mm_loadu_ps(&boxCenterY[i]), bz = _mm_loadu_ps(&boxCenterZ[i]);
+            const __m128 ex = _mm_loadu_ps(&extentX[i]), ey = _mm_loadu_ps(&extentY[i]), ez = _mm_loadu_ps(&extentZ[i]);
+
+            __m128 outside = zero;
+            for (int p = 0; p < 6; ++p)
+            {
+                // Küre: dot(n, c) + w + r < 0
+                __m128 sphere = _mm_add_ps(_mm_mul_ps(planeX[p], sx), planeW[p]);
+                sphere = _mm_add_ps(sphere, _mm_mul_ps(planeY[p], sy));
+                sphere = _mm_add_ps(sphere, _mm_mul_ps(planeZ[p], sz));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(sphere, r), zero));
+
+                // Kutu: dot(n, merkez) + w + dot(|n|, yarı boyut) < 0
+                __m128 box = _mm_add_ps(_mm_mul_ps(planeX[p], bx), planeW[p]);
+                box = _mm_add_ps(box, _mm_mul_ps(planeY[p], by));
+                box = _mm_add_ps(box, _mm_mul_ps(planeZ[p], bz));
+                box = _mm_add_ps(box, _mm_mul_ps(absX[p], ex));
+                box = _mm_add_ps(box, _mm_mul_ps(absY[p], ey));
+                box = _mm_add_ps(box, _mm_mul_ps(absZ[p], ez));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(box, zero));
+            }
+
+            const int mask = _mm_movemask_ps(outside);
+            const size_t lanes = std::min<size_t>(4, count - i);
+            for (size_t k = 0; k < lanes; ++k)
+                visible[i + k] = (mask >> k) & 1 ? 0 : 1;
+        }
+#else
+        cullScalar(frustum, visible);
+#endif
+    }
+
+    // Skaler yol: SSE yoksa cull() bunu kullanır. Toplama sırası SSE yoluyla
+    // aynıdır, iki yol sınırdaki nesnelerde de aynı kararı verir
+    // (tests/culling_simd.cpp karşılaştırır). Aynı SoA düzeni, derleyici iç
+    // döngüyü vektörleştirebilir.
+    void cullScalar(const Frustum &frustum, std::vector<uint8_t> &visible) const
+    {
+        visible.resize(count);
+        for (size_t i = 0; i < count; ++i)
+            visible[i] = 1;
+        for (const glm::vec4 &plane : frustum.planes)
+        {
+            const glm::vec3 absolute = glm::abs(glm::vec3(plane));
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float sphere = plane.x * sphereX[i] + plane.w + plane.y * sphereY[i] + plane.z * sphereZ[i];
+                const float box = plane.x * boxCenterX[i] + plane.w + plane.y * boxCenterY[i] + plane.z * boxCenterZ[i] +
+                                  absolute.x * extentX[i] + absolute.y * extentY[i] + absolute.z * extentZ[i];
+                if (sphere + radius[i] < 0.0f || box < 0.0f)
+                    visible[i] = 0;
+            }
+        }
+    }
+
+private:
+    std::vector<std::vector<float> *> arrays()
+    {
+        return {&boxCenterX, &boxCenterY, &boxCenterZ, &extentX, &extentY, &extentZ, &sphereX, &sphereY, &sphereZ, &radius};
+    }
+
+    size_t count = 0;
+    std::vector<float> boxCenterX, boxCenterY, boxCenterZ;
+    std::vector<float> extentX, extentY, extentZ;
+    std::vector<float> sphereX, sphereY, sphereZ, radius;
+};
+
+#endif
@@ -6,6 +6,9 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
 
+// Ana projeyle aynı kare verisi bloğu (FrameData, FrameDataBuffer)
+#include "../../../frame_data.h"
+
 // Ekran boyutu
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
@@ -16,12 +19,11 @@ glm::vec3 lightPos(1.2f, 1.0f, 2.0f);
 // Shader kodları
 const char* vertexShaderSource = R"(
 #version 330 core
+)" FRAME_DATA_GLSL R"(
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aNormal;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
 
 out vec3 FragPos;
 out vec3 Normal;
@@ -30,38 +32,36 @@ void main()
 {
     FragPos = vec3(model * vec4(aPos, 1.0));
     Normal = mat3(transpose(inverse(model))) * aNormal;  
-    gl_Position = projection * view * vec4(FragPos, 1.0);
+    gl_Position = viewProjection * vec4(FragPos, 1.0);
 }
 )";
 
 const char* fragmentShaderSource = R"(
 #version 330 core
+)" FRAME_DATA_GLSL R"(
 out vec4 FragColor;
 
 in vec3 FragPos;
 in vec3 Normal;
 
-uniform vec3 lightPos;
-uniform vec3 viewPos;
-
 void main()
 {
     // Ambient
     float ambientStrength = 0.1;
-    vec3 ambient = ambientStrength * vec3(1.0);
+    vec3 ambient = ambientStrength * lightColor.rgb;
 
     // Diffuse
     vec3 norm = normalize(Normal);
-    vec3 lightDir = normalize(lightPos - FragPos);
+    vec3 lightDir = normalize(lightPos.xyz - FragPos);
     float diff = max(dot(norm, lightDir), 0.0);
-    vec3 diffuse = diff * vec3(1.0);
+    vec3 diffuse = diff * lightColor.rgb;
 
     // Specular
     float specularStrength = 0.5;
-    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 viewDir = normalize(viewPos.xyz - FragPos);
     vec3 reflectDir = reflect(-lightDir, norm);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
-    vec3 specular = specularStrength * spec * vec3(1.0);
+    vec3 specular = specularStrength * spec * lightColor.rgb;
 
     vec3 result = (ambient + diffuse + specular);
     FragColor = vec4(result, 1.0);
@@ -180,6 +180,12 @@ int main() {
     glDeleteShader(fragmentShader);
     glDeleteShader(lightFragmentShader);
 
+    // Kare verisi (std140): iki program da aynı bloğu FRAME_DATA_BINDING noktasından okur
+    FrameDataBuffer frameDataBuffer;
+    frameDataBuffer.create();
+    glUniformBlockBinding(shaderProgram, glGetUniformBlockIndex(shaderProgram, "FrameData"), FRAME_DATA_BINDING);
+    glUniformBlockBinding(lightShaderProgram, glGetUniformBlockIndex(lightShaderProgram, "FrameData"), FRAME_DATA_BINDING);
+
     // === VAO/VBO ===
     GLuint VBO, cubeVAO, lightVAO;
     glGenVertexArrays(1, &cubeVAO);
@@ -219,14 +225,15 @@ int main() {
         glm::mat4 view = glm::translate(glm::mat4(1.0f), glm::vec3(0, 0, -5.0f));
         glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH/SCR_HEIGHT, 0.1f, 100.0f);
 
+        // Karede bir kere yüklenir
+        FrameData frameData = {view, projection, projection * view, glm::vec4(lightPos, 1.0f), glm::vec4(0, 0, 5, 1),
+                               glm::vec4(1.0f)};
+        frameDataBuffer.update(frameData);
+
         // === Ana küp ===
         glUseProgram(shaderProgram);
         glm::mat4 model = glm::rotate(glm::mat4(1.0f), glm::radians(30.0f), glm::vec3(1.0f, 1.0f, 0.0f));
         glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
-        glUniform3fv(glGetUniformLocation(shaderProgram, "lightPos"), 1, glm::value_ptr(lightPos));
-        glUniform3fv(glGetUniformLocation(shaderProgram, "viewPos"), 1, glm::value_ptr(glm::vec3(0, 0, 5)));
 
         glBindVertexArray(cubeVAO);
         glDrawArrays(GL_TRIANGLES, 0, 36);
@@ -236,8 +243,6 @@ int main() {
         glm::mat4 lightModel = glm::translate(glm::mat4(1.0f), lightPos);
         lightModel = glm::scale(lightModel, glm::vec3(0.2f));
         glUniformMatrix4fv(glGetUniformLocation(lightShaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(lightModel));
-        glUniformMatrix4fv(glGetUniformLocation(lightShaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(lightShaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
 
         glBindVertexArray(lightVAO);
         glDrawArrays(GL_TRIANGLES, 0, 36);
@@ -251,6 +256,7 @@ int main() {
     glDeleteVertexArrays(1, &cubeVAO);
     glDeleteVertexArrays(1, &lightVAO);
     glDeleteBuffers(1, &VBO);
+    frameDataBuffer.destroy();
     glDeleteProgram(shaderProgram);
     glDeleteProgram(lightShaderProgram);
 
@@ -0,0 +1,66 @@
+#ifndef FRAME_DATA_H
+#define FRAME_DATA_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include "gl_state.h"
+
+// FrameData bloğunun bağlandığı sabit uniform buffer noktası
+const GLuint FRAME_DATA_BINDING = 0;
+
+// Her programın ortak olarak tanımladığı kare verisi (std140).
+// Shader kaynaklarında #version satırından hemen sonra kullanılır.
+#define FRAME_DATA_GLSL                   \
+    "layout (std140) uniform FrameData\n" \
+    "{\n"                                 \
+    "    mat4 view;\n"                    \
+    "    mat4 projection;\n"              \
+    "    mat4 viewProjection;\n"          \
+    "    vec4 lightPos;   // xyz\n"       \
+    "    vec4 viewPos;    // xyz\n"       \
+    "    vec4 lightColor; // rgb\n"       \
+    "};\n"
+
+// FrameData bloğunun CPU tarafı; std140'ta vec3'ler vec4'e hizalandığı için
+// burada da vec4 kullanılır.
+struct FrameData
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 viewProjection;
+    glm::vec4 lightPos;
+    glm::vec4 viewPos;
+    glm::vec4 lightColor;
+};
+static_assert(sizeof(FrameData) == 240, "FrameData std140 düzenine uymalı");
+
+// Karede bir kere tek glBufferSubData ile doldurulan uniform buffer
+class FrameDataBuffer
+{
+public:
+    void create()
+    {
+        glGenBuffers(1, &ubo);
+        glState().bindBuffer(GL_UNIFORM_BUFFER, ubo);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameData), NULL, GL_DYNAMIC_DRAW);
+        glState().bindBufferBase(GL_UNIFORM_BUFFER, FRAME_DATA_BINDING, ubo);
+    }
+
+    void update(const FrameData &data)
+    {
+        glState().bindBuffer(GL_UNIFORM_BUFFER, ubo);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameData), &data);
+    }
+
+    void destroy()
+    {
+        glDeleteBuffers(1, &ubo);
+        ubo = 0;
+    }
+
+private:
+    GLuint ubo = 0;
+};
+
+#endif
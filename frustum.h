@@ -0,0 +1,57 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <glm/glm.hpp>
+
+// Görüş hacmi (frustum): view-projection matrisinden çıkarılan 6 düzlem
+// (Gribb-Hartmann). Düzlemlerin normalleri içeri bakar ve birim uzunluktadır,
+// böylece dot(düzlem.xyz, p) + düzlem.w noktanın düzleme işaretli uzaklığıdır.
+struct Frustum
+{
+    glm::vec4 planes[6]; // Sol, sağ, alt, üst, yakın, uzak
+};
+
+inline Frustum extractFrustum(const glm::mat4 &viewProjection)
+{
+    // glm sütun öncelikli: satır i = (m[0][i], m[1][i], m[2][i], m[3][i])
+    const glm::mat4 m = glm::transpose(viewProjection);
+    Frustum frustum;
+    frustum.planes[0] = m[3] + m[0];
+    frustum.planes[1] = m[3] - m[0];
+    frustum.planes[2] = m[3] + m[1];
+    frustum.planes[3] = m[3] - m[1];
+    frustum.planes[4] = m[3] + m[2];
+    frustum.planes[5] = m[3] - m[2];
+    for (glm::vec4 &plane : frustum.planes)
+        plane /= glm::length(glm::vec3(plane));
+    return frustum;
+}
+
+// Küre herhangi bir düzlemin tamamen dışındaysa görünmez (muhafazakâr: köşe
+// bölgelerindeki bazı küreler görünür sayılır)
+inline bool sphereInFrustum(const Frustum &frustum, const glm::vec3 &center, float radius)
+{
+    for (const glm::vec4 &plane : frustum.planes)
+    {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+            return false;
+    }
+    return true;
+}
+
+// Kutu bütünüyle bir düzlemin dışındaysa görünmez; düzlem normali yönündeki en
+// uzak köşe (pozitif köşe) test edilir
+inline bool aabbInFrustum(const Frustum &frustum, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+{
+    const glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+    const glm::vec3 extent = (boundsMax - boundsMin) * 0.5f;
+    for (const glm::vec4 &plane : frustum.planes)
+    {
+        const glm::vec3 normal(plane);
+        if (glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extent) < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+#endif
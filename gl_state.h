@@ -0,0 +1,301 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+#include <GL/glew.h>
+
+// Renderer'ın kare içinde kullandığı GL durumunun CPU'daki kopyası. Bir çağrı
+// mevcut durumu değiştirmeyecekse GL'e hiç gitmez; llvmpipe gibi her çağrıda
+// doğrulama yapan sürücülerde gereksiz bağlamalar ucuz değildir.
+// Önbelleğin dışından yapılan GL çağrılarından sonra invalidate() çağrılmalıdır.
+class GLStateCache
+{
+public:
+    GLStateCache()
+    {
+        invalidate();
+    }
+
+    // Bütün değerleri "bilinmiyor" yapar; sonraki her çağrı GL'e gider
+    void invalidate()
+    {
+        program = UNKNOWN;
+        vertexArray = UNKNOWN;
+        for (GLuint &buffer : buffers)
+            buffer = UNKNOWN;
+        for (GLuint &buffer : uniformBuffers)
+            buffer = UNKNOWN;
+        for (GLuint(&unit)[TEXTURE_TARGET_COUNT] : textures)
+            for (GLuint &texture : unit)
+                texture = UNKNOWN;
+        activeTextureUnit = UNKNOWN;
+        for (int &cap : caps)
+            cap = -1;
+        depthFunc = UNKNOWN;
+        depthMask = -1;
+        colorMask = -1;
+        blendSrc = blendDst = UNKNOWN;
+    }
+
+    void useProgram(GLuint id)
+    {
+        if (skip(program == id))
+            return;
+        program = id;
+        glUseProgram(id);
+    }
+
+    void bindVertexArray(GLuint id)
+    {
+        if (skip(vertexArray == id))
+            return;
+        vertexArray = id;
+        // Element buffer bağlantısı VAO'nun parçası
+        buffers[bufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+        glBindVertexArray(id);
+    }
+
+    void bindBuffer(GLenum target, GLuint id)
+    {
+        int slot = bufferSlot(target);
+        if (slot >= 0)
+        {
+            if (skip(buffers[slot] == id))
+                return;
+            buffers[slot] = id;
+        }
+        else
+            ++issued;
+        glBindBuffer(target, id);
+    }
+
+    // Aralık bağlamaları her seferinde GL'e gider (ofset her karede değişir);
+    // önbellekteki indeksli ve genel bağlama bilinmiyor olur
+    void bindBufferRange(GLenum target, GLuint index, GLuint id, GLintptr offset, GLsizeiptr size)
+    {
+        int slot = bufferSlot(target);
+        if (slot >= 0)
+            buffers[slot] = id;
+        if (target == GL_UNIFORM_BUFFER && index < MAX_UNIFORM_BUFFERS)
+            uniformBuffers[index] = UNKNOWN;
+        ++issued;
+        glBindBufferRange(target, index, id, offset, size);
+    }
+
+    // glBindBufferBase genel bağlama noktasını da değiştirir
+    void bindBufferBase(GLenum target, GLuint index, GLuint id)
+    {
+        int slot = bufferSlot(target);
+        if (target == GL_UNIFORM_BUFFER && index < MAX_UNIFORM_BUFFERS)
+        {
+            if (skip(uniformBuffers[index] == id))
+                return;
+            uniformBuffers[index] = id;
+        }
+        else
+            ++issued;
+        if (slot >= 0)
+            buffers[slot] = id;
+        glBindBufferBase(target, index, id);
+    }
+
+    void bindTexture(GLuint unit, GLenum target, GLuint id)
+    {
+        int slot = textureSlot(target);
+        if (slot >= 0 && unit < MAX_TEXTURE_UNITS)
+        {
+            if (skip(textures[unit][slot] == id))
+                return;
+            textures[unit][slot] = id;
+        }
+        else
+            ++issued;
+
+        if (activeTextureUnit != unit)
+        {
+            activeTextureUnit = unit;
+            glActiveTexture(GL_TEXTURE0 + unit);
+            ++issued;
+        }
+        glBindTexture(target, id);
+    }
+
+    void enable(GLenum cap)
+    {
+        setCap(cap, true);
+    }
+
+    void disable(GLenum cap)
+    {
+        setCap(cap, false);
+    }
+
+    void setDepthFunc(GLenum func)
+    {
+        if (skip(depthFunc == func))
+            return;
+        depthFunc = func;
+        glDepthFunc(func);
+    }
+
+    void setDepthMask(bool write)
+    {
+        if (skip(depthMask == (int)write))
+            return;
+        depthMask = (int)write;
+        glDepthMask(write ? GL_TRUE : GL_FALSE);
+    }
+
+    // Dört kanal birlikte açılır/kapanır (ör. yalnız derinlik yazan geçişler)
+    void setColorMask(bool write)
+    {
+        if (skip(colorMask == (int)write))
+            return;
+        colorMask = (int)write;
+        const GLboolean value = write ? GL_TRUE : GL_FALSE;
+        glColorMask(value, value, value, value);
+    }
+
+    void setBlendFunc(GLenum src, GLenum dst)
+    {
+        if (skip(blendSrc == src && blendDst == dst))
+            return;
+        blendSrc = src;
+        blendDst = dst;
+        glBlendFunc(src, dst);
+    }
+
+    // İstatistik: GL'e giden ve atlanan çağrılar (resetCounters'dan beri)
+    unsigned int issuedCount() const
+    {
+        return issued;
+    }
+
+    unsigned int elidedCount() const
+    {
+        return elided;
+    }
+
+    void resetCounters()
+    {
+        issued = elided = 0;
+    }
+
+private:
+    static const GLuint UNKNOWN = 0xFFFFFFFFu;
+    static const int BUFFER_TARGET_COUNT = 8;
+    static const int TEXTURE_TARGET_COUNT = 3;
+    static const int CAP_COUNT = 5;
+    static const GLuint MAX_UNIFORM_BUFFERS = 16;
+    static const GLuint MAX_TEXTURE_UNITS = 16;
+
+    static int bufferSlot(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER:
+            return 0;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return 1;
+        case GL_UNIFORM_BUFFER:
+            return 2;
+        case GL_TEXTURE_BUFFER:
+            return 3;
+        case GL_COPY_READ_BUFFER:
+            return 4;
+        case GL_COPY_WRITE_BUFFER:
+            return 5;
+        case GL_DRAW_INDIRECT_BUFFER:
+            return 6;
+        case GL_SHADER_STORAGE_BUFFER:
+            return 7;
+        default:
+            return -1;
+        }
+    }
+
+    static int textureSlot(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_TEXTURE_2D:
+            return 0;
+        case GL_TEXTURE_BUFFER:
+            return 1;
+        case GL_TEXTURE_CUBE_MAP:
+            return 2;
+        default:
+            return -1;
+        }
+    }
+
+    static int capSlot(GLenum cap)
+    {
+        switch (cap)
+        {
+        case GL_DEPTH_TEST:
+            return 0;
+        case GL_BLEND:
+            return 1;
+        case GL_CULL_FACE:
+            return 2;
+        case GL_SCISSOR_TEST:
+            return 3;
+        case GL_STENCIL_TEST:
+            return 4;
+        default:
+            return -1;
+        }
+    }
+
+    void setCap(GLenum cap, bool on)
+    {
+        int slot = capSlot(cap);
+        if (slot >= 0)
+        {
+            if (skip(caps[slot] == (int)on))
+                return;
+            caps[slot] = (int)on;
+        }
+        else
+            ++issued;
+
+        if (on)
+            glEnable(cap);
+        else
+            glDisable(cap);
+    }
+
+    // Sayaçları günceller; true ise çağrı gereksizdir
+    bool skip(bool same)
+    {
+        if (same)
+            ++elided;
+        else
+            ++issued;
+        return same;
+    }
+
+    GLuint program;
+    GLuint vertexArray;
+    GLuint buffers[BUFFER_TARGET_COUNT];
+    GLuint uniformBuffers[MAX_UNIFORM_BUFFERS];
+    GLuint textures[MAX_TEXTURE_UNITS][TEXTURE_TARGET_COUNT];
+    GLuint activeTextureUnit;
+    int caps[CAP_COUNT]; // -1 bilinmiyor, 0 kapalı, 1 açık
+    GLenum depthFunc;
+    int depthMask;
+    int colorMask;
+    GLenum blendSrc;
+    GLenum blendDst;
+    unsigned int issued = 0;
+    unsigned int elided = 0;
+};
+
+// Tek GL bağlamı olduğu için tek önbellek
+inline GLStateCache &glState()
+{
+    static GLStateCache cache;
+    return cache;
+}
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef LOD_H
+#define LOD_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "procedural_mesh.h"
+
+// Ekran uzayı hatasına göre ayrıntı seviyesi (LOD) seçimi. Her seviye, en
+// doğru yüzeye göre model uzayındaki en büyük geometrik hatasıyla (ör.
+// çemberi kesen kirişin sapması) saklanır. Her karede bu hata nesnenin
+// uzaklığına göre piksele çevrilir ve eşiği aşmayan en kaba seviye seçilir.
+const float LOD_PIXEL_ERROR = 1.0f; // Kabul edilen ekran hatası (piksel)
+const float LOD_HYSTERESIS = 0.6f;  // Kaba seviyeye geçmek için hata eşiğin bu oranının altına inmeli
+const int LOD_MIN_SEGMENTS = 4;
+
+// 1 birim uzaklıktaki 1 birimlik hatanın piksel karşılığı
+inline float lodPixelScale(float fovY, float viewportHeight)
+{
+    return viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+}
+
+// Seviyeler ince'den kabaya sıralı eklenir. Level çizilecek şeyi tanımlar:
+// arena yolunda MeshRange, AZDO / Vulkan yollarında komut indeksi.
+template <class Level>
+class LodChain
+{
+public:
+    LodChain() = default;
+
+    LodChain(glm::vec3 boundsMin, glm::vec3 boundsMax)
+        : center((boundsMin + boundsMax) * 0.5f), radius(glm::length(boundsMax - boundsMin) * 0.5f)
+    {
+    }
+
+    void addLevel(const Level &level, float error)
+    {
+        levels.push_back(level);
+        errors.push_back(error);
+    }
+
+    size_t levelCount() const
+    {
+        return levels.size();
+    }
+
+    const Level &level(size_t i) const
+    {
+        return levels[i];
+    }
+
+    // Bu karenin seviyesini seçer. Eşik iki yönde farklıdır (histerezis): daha
+    // ince seviyeye hata eşiği aşınca, daha kabaya ise hata eşiğin belirgin
+    // biçimde altına inince geçilir; sınırdaki nesne her karede titremez.
+    size_t select(const glm::mat4 &view, const glm::mat4 &model, float pixelScale)
+    {
+        if (levels.empty())
+            return 0;
+
+        // Sınır küresinin kameraya en yakın noktası; kameranın içinde kaldığı
+        // küre en ince seviyeyi alır
+        const float scale = std::max(glm::length(glm::vec3(model[0])),
+                                     std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+        const glm::vec3 viewCenter = glm::vec3(view * (model * glm::vec4(center, 1.0f)));
+        const float distance = glm::length(viewCenter) - radius * scale;
+        if (distance <= 0.0f)
+        {
+            current = 0;
+            return current;
+        }
+
+        const float pixelsPerUnit = scale * pixelScale / distance;
+        while (current > 0 && errors[current] * pixelsPerUnit > LOD_PIXEL_ERROR)
+            --current;
+        while (current + 1 < levels.size() && errors[current + 1] * pixelsPerUnit < LOD_PIXEL_ERROR * LOD_HYSTERESIS)
+            ++current;
+        return current;
+    }
+
+    size_t selected() const
+    {
+        return current;
+    }
+
+private:
+    std::vector<Level> levels;
+    std::vector<float> errors;
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+    size_t current = 0;
+};
+
+// Yay açısı angle olan kirişin yaydan en büyük uzaklığı (sagitta)
+inline float chordError(float radius, float angle)
+{
+    return radius * (1.0f - std::cos(angle * 0.5f));
+}
+
+// Prosedürel meshin gerçek yüzeyden en büyük sapması: eksen etrafındaki
+// bölümlerden ve (küre, torus) profil çemberinin bölümlerinden gelen hata
+inline float proceduralMeshError(const ProceduralMeshDesc &desc)
+{
+    const float pi = 3.14159265358979f;
+    switch (desc.shape)
+    {
+    case PROCEDURAL_SPHERE:
+        return std::max(chordError(desc.radius, 2.0f * pi / desc.segments), chordError(desc.radius, pi / desc.rings));
+    case PROCEDURAL_TORUS:
+        return std::max(chordError(desc.radius + desc.size, 2.0f * pi / desc.segments),
+                        chordError(desc.size, 2.0f * pi / desc.rings));
+    default:
+        // Silindir ve koni gövdesi doğrusal; sadece taban çemberi
+        return chordError(desc.radius, 2.0f * pi / desc.segments);
+    }
+}
+
+// desc'i en ince seviye kabul edip her seviyede bölüm sayılarını yarıya
+// indirerek en fazla levelCount seviye üretir. add(desc) seviyeyi çizilebilir
+// hale getirir (arenaya, indirect komutlara ...) ve Level'ı döndürür.
+template <class Level, class AddFn>
+LodChain<Level> buildProceduralLods(const ProceduralMeshDesc &desc, int levelCount, AddFn add)
+{
+    glm::vec3 boundsMin, boundsMax;
+    proceduralMeshBounds(desc, boundsMin, boundsMax);
+    LodChain<Level> chain(boundsMin, boundsMax);
+
+    ProceduralMeshDesc level = desc;
+    for (int i = 0; i < levelCount; ++i)
+    {
+        chain.addLevel(add(level), proceduralMeshError(level));
+
+        const int segments = std::max(LOD_MIN_SEGMENTS, level.segments / 2);
+        int rings = level.rings;
+        if (desc.shape == PROCEDURAL_SPHERE)
+            rings = std::max(2, rings / 2);
+        else if (desc.shape == PROCEDURAL_TORUS)
+            rings = std::max(3, rings / 2);
+        if (segments == level.segments && rings == level.rings)
+            break;
+        level.segments = segments;
+        level.rings = rings;
+    }
+    return chain;
+}
+
+#endif
@@ -1,4 +1,7 @@
 #include <GL/glew.h>
+#ifdef USE_VULKAN
+#include <vulkan/vulkan.h> // glfwCreateWindowSurface için glfw3.h'den önce
+#endif
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -6,11 +9,53 @@
 #include <iostream>
 #include <cmath>
 #include <vector>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "azdo_renderer.h"
+#include "box_builder.h"
+#include "cell_portal.h"
+#include "culling.h"
+#include "frame_data.h"
+#include "lod.h"
+#include "mesh_arena.h"
+#include "occlusion_queries.h"
+#include "procedural_mesh.h"
+#include "render_queue.h"
+#include "shader_program.h"
+#include "software_occlusion.h"
+#include "static_batch.h"
+#include "transform_buffer.h"
+#include "vulkan_renderer.h"
 
 // Pencere boyutları
 const unsigned int SCR_WIDTH = 1700;
 const unsigned int SCR_HEIGHT = 900;
 
+// Projeksiyon kırpma düzlemleri
+const float NEAR_PLANE = 0.1f;
+const float FAR_PLANE = 100.0f;
+
+// GPU vertex düzeni: sahnenin dünya uzayı pozisyonları half'a sığıyorsa
+// (yuvarlama hatası HALF_POSITION_MAX_ERROR altında) PackedHalfVertexLayout,
+// 16 bayt; sığmıyorsa ya da false ise PackedVertexLayout, 20 bayt
+const bool USE_HALF_POSITIONS = true;
+
+// Bağlam destekliyorsa OpenGL 4.5 AZDO yolu; değilse (ya da false ise) 3.3 yolu
+const bool USE_AZDO_BACKEND = true;
+
+// 3.3 yolunda statik yığının nesneleri ayrıca donanım örtme sorgularıyla
+// (vekil kutu + koşullu çizim) ayıklanır; kazancı sonda yazılan sayaçlardan izlenir
+const bool USE_OCCLUSION_QUERIES = true;
+
+// Çizim indeksleri: 0 statik yığın (birim matris), 1 ampul
+const GLuint STATIC_DRAW_INDEX = 0;
+const GLuint LAMP_DRAW_INDEX = 1;
+
+// Prosedürel meshler için LOD seviyesi sayısı (her seviye bölüm sayısının yarısı)
+const int LAMP_LOD_LEVELS = 3;
+
 // Kamera ayarları
 glm::vec3 cameraPos = glm::vec3(0.0f, 1.0f, 8.0f);
 glm::vec3 cameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
@@ -35,13 +80,16 @@ void framebuffer_size_callback(GLFWwindow *window, int width, int height);
 void mouse_callback(GLFWwindow *window, double xpos, double ypos);
 void processInput(GLFWwindow *window);
 unsigned int loadShader(const char *vertexPath, const char *fragmentPath);
-unsigned int createCube();
-std::vector<float> createSphereVertices(float radius, int sectorCount, int stackCount, glm::vec3 color);
-std::vector<unsigned int> createSphereIndices(int sectorCount, int stackCount);
-unsigned int createSphere(float radius, int sectorCount, int stackCount, glm::vec3 color);
+void buildScene(StaticBatch &staticBatch, std::vector<ProceduralMeshDesc> &lampParts);
+void buildCells(CellPortalGraph &cells);
+bool sceneFitsHalf(const StaticBatch &staticBatch, const std::vector<ProceduralMeshDesc> &lampParts);
+#ifdef USE_VULKAN
+int runVulkan();
+#endif
 
 const char *vertexShaderSource = R"(
 #version 330 core
+)" FRAME_DATA_GLSL TRANSFORM_BUFFER_GLSL R"(
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec3 aColor;
@@ -50,47 +98,75 @@ out vec3 FragPos;
 out vec3 Normal;
 out vec3 Color;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+// MVP ve normal matrisi CPU'da nesne başına bir kere hesaplanır
+void main() {
+    int base = transformBase();
+    FragPos = vec3(fetchMat4(base + 4) * vec4(aPos, 1.0));
+    Normal = fetchMat3(base + 8) * aNormal;
+    Color = aColor;
+    gl_Position = fetchMat4(base) * vec4(aPos, 1.0);
+}
+)";
+
+// AZDO yolu (GL 4.5) için vertex shader: dönüşümler shader storage buffer'da,
+// çizim indeksi indirect komutun baseInstance'ından
+const char *azdoVertexShaderSource = R"(
+#version 450 core
+)" FRAME_DATA_GLSL R"(
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec3 aColor;
+layout (location = 3) in uint aDrawIndex;
+
+struct DrawTransform {
+    mat4 mvp;
+    mat4 model;
+    vec4 normalMatrix[3];
+};
+
+layout (std430, binding = 1) readonly buffer Transforms {
+    DrawTransform transforms[];
+};
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec3 Color;
 
 void main() {
-    FragPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(model))) * aNormal;
+    DrawTransform t = transforms[aDrawIndex];
+    FragPos = vec3(t.model * vec4(aPos, 1.0));
+    Normal = mat3(t.normalMatrix[0].xyz, t.normalMatrix[1].xyz, t.normalMatrix[2].xyz) * aNormal;
     Color = aColor;
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    gl_Position = t.mvp * vec4(aPos, 1.0);
 }
 )";
 
 const char *fragmentShaderSource = R"(
 #version 330 core
+)" FRAME_DATA_GLSL R"(
 out vec4 FragColor;
 
 in vec3 FragPos;
 in vec3 Normal;
 in vec3 Color;
 
-uniform vec3 lightPos;
-uniform vec3 viewPos;
-uniform vec3 lightColor;
-
 void main() {
     // Ambient
     float ambientStrength = 0.3;
-    vec3 ambient = ambientStrength * lightColor;
+    vec3 ambient = ambientStrength * lightColor.rgb;
       
     // Diffuse 
     vec3 norm = normalize(Normal);
-    vec3 lightDir = normalize(lightPos - FragPos);
+    vec3 lightDir = normalize(lightPos.xyz - FragPos);
     float diff = max(dot(norm, lightDir), 0.0);
-    vec3 diffuse = diff * lightColor;
+    vec3 diffuse = diff * lightColor.rgb;
     
     // Specular
     float specularStrength = 0.5;
-    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 viewDir = normalize(viewPos.xyz - FragPos);
     vec3 reflectDir = reflect(-lightDir, norm);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
-    vec3 specular = specularStrength * spec * lightColor;
+    vec3 specular = specularStrength * spec * lightColor.rgb;
         
     vec3 result = (ambient + diffuse + specular) * Color;
     FragColor = vec4(result, 1.0);
@@ -106,14 +182,31 @@ int main()
         return -1;
     }
 
-    // OpenGL versiyonu ayarla
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+#ifdef USE_VULKAN
+    // -DUSE_VULKAN ile derlendiyse sahne Vulkan ile çizilir
+    int result = runVulkan();
+    glfwTerminate();
+    return result;
+#endif
+
+    // OpenGL versiyonu ayarla: önce 4.5 denenir, olmazsa 3.3
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 
     // Pencere oluştur
-    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Çalışma Masası Modeli", NULL, NULL);
+    GLFWwindow *window = NULL;
+    if (USE_AZDO_BACKEND)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Çalışma Masası Modeli", NULL, NULL);
+    }
+    if (!window)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Çalışma Masası Modeli", NULL, NULL);
+    }
     if (!window)
     {
         std::cerr << "Pencere oluşturulamadı!" << std::endl;
@@ -136,852 +229,95 @@ int main()
         return -1;
     }
 
+    // Çizim yolu başlangıçta bir kere seçilir
+    const bool useAzdo = USE_AZDO_BACKEND && AzdoRenderer::supported();
+    std::cout << "Renderer: " << (useAzdo ? "OpenGL 4.5 AZDO" : "OpenGL 3.3") << std::endl;
+
     // Derinlik testi etkinleştir
-    glEnable(GL_DEPTH_TEST);
+    glState().enable(GL_DEPTH_TEST);
+
+    // 3.3 yolu: program, kare UBO'su, dönüşüm tamponu ve çizim kuyruğu
+    ShaderProgram shaderProgram;
+    FrameDataBuffer frameDataBuffer;
+    TransformBuffer transformBuffer;
+    RenderQueue renderQueue;
+    UniformHandle drawIndexUniform;
+    int sceneProgramId = 0;
+    if (!useAzdo)
+    {
+        // Shader programı oluştur; uniform konumları link sırasında bir kere çözülür
+        shaderProgram = ShaderProgram(createShaderProgram(vertexShaderSource, fragmentShaderSource));
 
-    // Shader programı oluştur
-    unsigned int shaderProgram = glCreateProgram();
+        // Kamera ve ışık verisi bütün programların paylaştığı tek bir UBO'da
+        shaderProgram.bindUniformBlock("FrameData", FRAME_DATA_BINDING);
+        frameDataBuffer.create();
 
-    // Vertex shader
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
+        // Model matrisleri karede bir kere texture buffer'a yüklenir
+        transformBuffer.create();
+        shaderProgram.use();
+        shaderProgram.set(shaderProgram.uniform("transforms"), (int)TRANSFORM_BUFFER_UNIT);
 
-    // Vertex shader derleme kontrolü
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-                  << infoLog << std::endl;
+        // Çizimler her karede anahtarlarına göre sıralanır
+        sceneProgramId = renderQueue.addProgram(shaderProgram);
+        drawIndexUniform = shaderProgram.uniform("drawIndex");
     }
 
-    // Fragment shader
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Fragment shader derleme kontrolü
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
+    // Sahne: hiç hareket etmeyen her şey statik yığında, ampul ayrı
+    StaticBatch staticBatch;
+    std::vector<ProceduralMeshDesc> lampParts;
+    buildScene(staticBatch, lampParts);
+    const bool halfPositions = USE_HALF_POSITIONS && sceneFitsHalf(staticBatch, lampParts);
+
+    // Büyük örtücüler (duvarlar, taban, masa) her karede CPU'da küçük bir
+    // derinlik tamponuna çizilir; arkalarında kalan nesneler gönderilmez
+    SoftwareOcclusion occlusion;
+    occlusion.setOccluders(staticBatch.occluderTriangles());
+    WorkerPool occlusionWorkers;
+
+    // Oda bir hücre; açık ön yüzü dışarıdaki hücreye açılan portal. Kamera
+    // bir hücredeyse sadece portallardan ulaşılan hücrelerin nesneleri çizilir.
+    CellPortalGraph cells;
+    buildCells(cells);
+    staticBatch.assignCells(cells);
+
+    MeshArena meshArena;
+    std::vector<LodChain<MeshRange>> lampLods;
+    OcclusionQueries occlusionQueries;
+    AzdoRenderer azdoRenderer;
+    std::vector<LodChain<size_t>> lampCommandLods;
+    if (useAzdo)
     {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-                  << infoLog << std::endl;
+        // Bütün sahne tek indirect çağrıda; ampulün parçalarının her LOD seviyesi
+        // ayrı bir komut, her karede sadece seçilen seviye açık
+        azdoRenderer.addStaticBatch(staticBatch, STATIC_DRAW_INDEX);
+        for (const ProceduralMeshDesc &part : lampParts)
+            lampCommandLods.push_back(buildProceduralLods<size_t>(part, LAMP_LOD_LEVELS, [&](const ProceduralMeshDesc &level)
+                                                                  { return azdoRenderer.addProcedural(level, LAMP_DRAW_INDEX); }));
+        withPositionLayout(halfPositions, [&](auto layout)
+                           { azdoRenderer.create<decltype(layout)>(azdoVertexShaderSource, fragmentShaderSource); });
     }
-
-    // Shader programını link et
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    // Shader programı link kontrolü
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success)
+    else
     {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
-                  << infoLog << std::endl;
+        // Bütün meshler tek bir VBO/VAO içinde (mesh arenası): statik yığın tek aralık,
+        // hareketli nesneler (ampul ışıkla birlikte) kendi aralıklarında
+        staticBatch.addTo(meshArena);
+        // Ampulün parçaları (bütün LOD seviyeleri) upload() sırasında doğrudan
+        // GPU belleğine üretilir
+        for (const ProceduralMeshDesc &part : lampParts)
+            lampLods.push_back(buildProceduralLods<MeshRange>(part, LAMP_LOD_LEVELS, [&](const ProceduralMeshDesc &level)
+                                                              { return meshArena.addProcedural(level); }));
+        withPositionLayout(halfPositions, [&](auto layout)
+                           { meshArena.upload<decltype(layout)>(); });
+        if (USE_OCCLUSION_QUERIES)
+            occlusionQueries.create(staticBatch.objectList().size());
     }
 
-    // Shader objeleri artık gerekli değil
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    // Masa için vertex verileri
-    float deskVertices[] = {
-        // pozisyonlar          // normallar         // renkler (kahverengi)
-        // Üst yüzey
-        -1.5f, -0.1f, -0.8f, 0.0f, 1.0f, 0.0f, 0.55f, 0.27f, 0.07f,
-        1.5f, -0.1f, -0.8f, 0.0f, 1.0f, 0.0f, 0.55f, 0.27f, 0.07f,
-        1.5f, -0.1f, 0.8f, 0.0f, 1.0f, 0.0f, 0.55f, 0.27f, 0.07f,
-        1.5f, -0.1f, 0.8f, 0.0f, 1.0f, 0.0f, 0.55f, 0.27f, 0.07f,
-        -1.5f, -0.1f, 0.8f, 0.0f, 1.0f, 0.0f, 0.55f, 0.27f, 0.07f,
-        -1.5f, -0.1f, -0.8f, 0.0f, 1.0f, 0.0f, 0.55f, 0.27f, 0.07f,
-    
-        // Masa alt yüzü
-        -1.5f, -0.15f, -0.8f, 0.0f, -1.0f, 0.0f, 0.45f, 0.20f, 0.05f,
-        1.5f, -0.15f, -0.8f, 0.0f, -1.0f, 0.0f, 0.45f, 0.20f, 0.05f,
-        1.5f, -0.15f, 0.8f, 0.0f, -1.0f, 0.0f, 0.45f, 0.20f, 0.05f,
-        1.5f, -0.15f, 0.8f, 0.0f, -1.0f, 0.0f, 0.45f, 0.20f, 0.05f,
-        -1.5f, -0.15f, 0.8f, 0.0f, -1.0f, 0.0f, 0.45f, 0.20f, 0.05f,
-        -1.5f, -0.15f, -0.8f, 0.0f, -1.0f, 0.0f, 0.45f, 0.20f, 0.05f,
-    
-        // Masa kenarları
-        -1.5f, -0.15f, -0.8f, 0.0f, 0.0f, -1.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.15f, -0.8f, 0.0f, 0.0f, -1.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, -0.8f, 0.0f, 0.0f, -1.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, -0.8f, 0.0f, 0.0f, -1.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.1f, -0.8f, 0.0f, 0.0f, -1.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.15f, -0.8f, 0.0f, 0.0f, -1.0f, 0.50f, 0.25f, 0.06f,
-    
-        1.5f, -0.15f, -0.8f, 1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.15f, 0.8f, 1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, 0.8f, 1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, 0.8f, 1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, -0.8f, 1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.15f, -0.8f, 1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-    
-        -1.5f, -0.15f, 0.8f, 0.0f, 0.0f, 1.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.15f, 0.8f, 0.0f, 0.0f, 1.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, 0.8f, 0.0f, 0.0f, 1.0f, 0.50f, 0.25f, 0.06f,
-        1.5f, -0.1f, 0.8f, 0.0f, 0.0f, 1.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.1f, 0.8f, 0.0f, 0.0f, 1.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.15f, 0.8f, 0.0f, 0.0f, 1.0f, 0.50f, 0.25f, 0.06f,
-    
-        -1.5f, -0.15f, -0.8f, -1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.15f, 0.8f, -1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.1f, 0.8f, -1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.1f, 0.8f, -1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.1f, -0.8f, -1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-        -1.5f, -0.15f, -0.8f, -1.0f, 0.0f, 0.0f, 0.50f, 0.25f, 0.06f,
-    };
-
-    // Ampul modeli için vertex verileri
-    float lampVertices[] = {
-        // Taban çemberi (8 nokta kullanarak yaklaşık bir çember)
-        // positions               // normals             // colors
-        0.0f, 0.0f, 0.0f,        0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,  // Merkez
-        0.1f, 0.0f, 0.0f,        0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        0.07f, 0.0f, 0.07f,      0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        0.0f, 0.0f, 0.1f,        0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        -0.07f, 0.0f, 0.07f,     0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        -0.1f, 0.0f, 0.0f,       0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        -0.07f, 0.0f, -0.07f,    0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        0.0f, 0.0f, -0.1f,       0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        0.07f, 0.0f, -0.07f,     0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,
-        0.1f, 0.0f, 0.0f,        0.0f, -1.0f, 0.0f,    1.0f, 1.0f, 0.8f,  // Çemberi kapatmak için tekrar
-        
-        // Koni yüzeyi
-        0.0f, 0.2f, 0.0f,        0.0f, 1.0f, 0.0f,     1.0f, 1.0f, 0.8f,  // Tepe nokta
-        0.1f, 0.0f, 0.0f,        0.5f, 0.5f, 0.0f,     1.0f, 1.0f, 0.8f,
-        0.07f, 0.0f, 0.07f,      0.35f, 0.5f, 0.35f,   1.0f, 1.0f, 0.8f,
-        0.0f, 0.0f, 0.1f,        0.0f, 0.5f, 0.5f,     1.0f, 1.0f, 0.8f,
-        -0.07f, 0.0f, 0.07f,     -0.35f, 0.5f, 0.35f,  1.0f, 1.0f, 0.8f,
-        -0.1f, 0.0f, 0.0f,       -0.5f, 0.5f, 0.0f,    1.0f, 1.0f, 0.8f,
-        -0.07f, 0.0f, -0.07f,    -0.35f, 0.5f, -0.35f, 1.0f, 1.0f, 0.8f,
-        0.0f, 0.0f, -0.1f,       0.0f, 0.5f, -0.5f,    1.0f, 1.0f, 0.8f,
-        0.07f, 0.0f, -0.07f,     0.35f, 0.5f, -0.35f,  1.0f, 1.0f, 0.8f,
-        0.1f, 0.0f, 0.0f,        0.5f, 0.5f, 0.0f,     1.0f, 1.0f, 0.8f,  // Çemberi kapatmak için tekrar
-    
-        // Metal kısım (silindir üst yüzeyi)
-        0.02f, 0.2f, 0.02f,      0.0f, 1.0f, 0.0f,     0.7f, 0.7f, 0.7f,
-        -0.02f, 0.2f, 0.02f,     0.0f, 1.0f, 0.0f,     0.7f, 0.7f, 0.7f,
-        -0.02f, 0.2f, -0.02f,    0.0f, 1.0f, 0.0f,     0.7f, 0.7f, 0.7f,
-        0.02f, 0.2f, -0.02f,     0.0f, 1.0f, 0.0f,     0.7f, 0.7f, 0.7f,
-        0.02f, 0.3f, 0.02f,      0.0f, 1.0f, 0.0f,     0.7f, 0.7f, 0.7f,
-        -0.02f, 0.3f, 0.02f,     0.0f, 1.0f, 0.0f,     0.7f, 0.7f, 0.7f
-    };
-
-    // Ampul VAO/VBO
-    unsigned int lampVAO, lampVBO;
-    glGenVertexArrays(1, &lampVAO);
-    glGenBuffers(1, &lampVBO);
-
-    glBindVertexArray(lampVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, lampVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(lampVertices), lampVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Masa ayakları için vertex verileri
-    float legVertices[] = {
-        // positions          // normals           // colors (dark brown)
-        -0.05f, -0.8f, -0.05f, 0.0f, 0.0f, -1.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, -0.8f, -0.05f, 0.0f, 0.0f, -1.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, 0.0f, -0.05f, 0.0f, 0.0f, -1.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, 0.0f, -0.05f, 0.0f, 0.0f, -1.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, 0.0f, -0.05f, 0.0f, 0.0f, -1.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, -0.8f, -0.05f, 0.0f, 0.0f, -1.0f, 0.35f, 0.18f, 0.04f,
-    
-        -0.05f, -0.8f, 0.05f, 0.0f, 0.0f, 1.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, -0.8f, 0.05f, 0.0f, 0.0f, 1.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, 0.0f, 0.05f, 0.0f, 0.0f, 1.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, 0.0f, 0.05f, 0.0f, 0.0f, 1.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, 0.0f, 0.05f, 0.0f, 0.0f, 1.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, -0.8f, 0.05f, 0.0f, 0.0f, 1.0f, 0.35f, 0.18f, 0.04f,
-    
-        -0.05f, 0.0f, 0.05f, -1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, 0.0f, -0.05f, -1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, -0.8f, -0.05f, -1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, -0.8f, -0.05f, -1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, -0.8f, 0.05f, -1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        -0.05f, 0.0f, 0.05f, -1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-    
-        0.05f, 0.0f, 0.05f, 1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, 0.0f, -0.05f, 1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, -0.8f, -0.05f, 1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, -0.8f, -0.05f, 1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, -0.8f, 0.05f, 1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-        0.05f, 0.0f, 0.05f, 1.0f, 0.0f, 0.0f, 0.35f, 0.18f, 0.04f,
-    };
-
-    // Monitör için vertex verileri
-    float monitorVertices[] = {
-        // pozisyonlar          // normallar         // renkler (siyah)
-        // Ana ekran yüzeyi (ekran kısmı - koyu siyah)
-        -0.3f, 0.0f, -0.02f, 0.0f, 0.0f, 1.0f, 0.05f, 0.05f, 0.05f,
-        0.3f, 0.0f, -0.02f, 0.0f, 0.0f, 1.0f, 0.05f, 0.05f, 0.05f,
-        0.3f, 0.4f, -0.02f, 0.0f, 0.0f, 1.0f, 0.05f, 0.05f, 0.05f,
-        0.3f, 0.4f, -0.02f, 0.0f, 0.0f, 1.0f, 0.05f, 0.05f, 0.05f,
-        -0.3f, 0.4f, -0.02f, 0.0f, 0.0f, 1.0f, 0.05f, 0.05f, 0.05f,
-        -0.3f, 0.0f, -0.02f, 0.0f, 0.0f, 1.0f, 0.05f, 0.05f, 0.05f,
-
-        // Monitör çerçevesi (gri)
-        -0.32f, -0.02f, -0.03f, 0.0f, 0.0f, 1.0f, 0.3f, 0.3f, 0.3f,
-        0.32f, -0.02f, -0.03f, 0.0f, 0.0f, 1.0f, 0.3f, 0.3f, 0.3f,
-        0.32f, 0.42f, -0.03f, 0.0f, 0.0f, 1.0f, 0.3f, 0.3f, 0.3f,
-        0.32f, 0.42f, -0.03f, 0.0f, 0.0f, 1.0f, 0.3f, 0.3f, 0.3f,
-        -0.32f, 0.42f, -0.03f, 0.0f, 0.0f, 1.0f, 0.3f, 0.3f, 0.3f,
-        -0.32f, -0.02f, -0.03f, 0.0f, 0.0f, 1.0f, 0.3f, 0.3f, 0.3f,
-
-        // Monitör standı (koyu gri)
-        -0.05f, -0.02f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,
-        0.05f, -0.02f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,
-        0.05f, -0.1f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,
-        0.05f, -0.1f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,
-        -0.05f, -0.1f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,
-        -0.05f, -0.02f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,
-
-        // Monitör taban (koyu gri) - Y koordinatlarını artırarak tabanı yukarı kaldır
-        -0.15f, -0.09f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f, // Eski: -0.15f, -0.1f, -0.03f
-        0.15f, -0.09f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,  // Eski: 0.15f, -0.1f, -0.03f
-        0.15f, -0.09f, 0.1f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,    // Eski: 0.15f, -0.1f, 0.1f
-        0.15f, -0.09f, 0.1f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,    // Eski: 0.15f, -0.1f, 0.1f
-        -0.15f, -0.09f, 0.1f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f,   // Eski: -0.15f, -0.1f, 0.1f
-        -0.15f, -0.09f, -0.03f, 0.0f, 0.0f, 1.0f, 0.2f, 0.2f, 0.2f, // Eski: -0.15f, -0.1f, -0.03f
-    };
-
-    // Mouse için dikdörtgen küp (3D blok)
-    float mouseVertices[] = {
-        // Top face
-        -0.03f, -0.07f, -0.03f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.03f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.08f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.08f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.08f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.03f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-
-        // Bottom face
-        -0.03f, -0.11f, -0.03f, 0.0f, -1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.03f, 0.0f, -1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.08f, 0.0f, -1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.08f, 0.0f, -1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.11f, -0.08f, 0.0f, -1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.11f, -0.03f, 0.0f, -1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-
-        // Front face
-        -0.03f, -0.11f, -0.03f, 0.0f, 0.0f, 1.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.03f, 0.0f, 0.0f, 1.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.03f, 0.0f, 0.0f, 1.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.03f, 0.0f, 0.0f, 1.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.03f, 0.0f, 0.0f, 1.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.11f, -0.03f, 0.0f, 0.0f, 1.0f, 0.15f, 0.15f, 0.15f,
-
-        // Back face
-        -0.03f, -0.11f, -0.08f, 0.0f, 0.0f, -1.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.08f, 0.0f, 0.0f, -1.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.08f, 0.0f, 0.0f, -1.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.08f, 0.0f, 0.0f, -1.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.08f, 0.0f, 0.0f, -1.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.11f, -0.08f, 0.0f, 0.0f, -1.0f, 0.15f, 0.15f, 0.15f,
-
-        // Left face
-        -0.03f, -0.11f, -0.03f, -1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.11f, -0.08f, -1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.08f, -1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.08f, -1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.07f, -0.03f, -1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        -0.03f, -0.11f, -0.03f, -1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-
-        // Right face
-        0.03f, -0.11f, -0.03f, 1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.08f, 1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.08f, 1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.08f, 1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.07f, -0.03f, 1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        0.03f, -0.11f, -0.03f, 1.0f, 0.0f, 0.0f, 0.15f, 0.15f, 0.15f};
-
-        float keyboardVertices[] = {
-            // Ana klavye gövdesi (siyah)
-            // pozisyonlar          // normallar         // renkler (siyah)
-            // Üst yüzey
-            -0.25f, -0.09f, -0.15f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-            0.25f, -0.09f, -0.15f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-            0.25f, -0.09f, -0.35f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-            0.25f, -0.09f, -0.35f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-            -0.25f, -0.09f, -0.35f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-            -0.25f, -0.09f, -0.15f, 0.0f, 1.0f, 0.0f, 0.15f, 0.15f, 0.15f,
-        
-            // Alt yüzey
-            -0.25f, -0.11f, -0.15f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.1f,
-            0.25f, -0.11f, -0.15f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.1f,
-            0.25f, -0.11f, -0.35f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.1f,
-            0.25f, -0.11f, -0.35f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.1f,
-            -0.25f, -0.11f, -0.35f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.1f,
-            -0.25f, -0.11f, -0.15f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.1f,
-        
-            // Ön yüzey
-            -0.25f, -0.11f, -0.15f, 0.0f, 0.0f, 1.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.11f, -0.15f, 0.0f, 0.0f, 1.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.15f, 0.0f, 0.0f, 1.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.15f, 0.0f, 0.0f, 1.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.09f, -0.15f, 0.0f, 0.0f, 1.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.11f, -0.15f, 0.0f, 0.0f, 1.0f, 0.12f, 0.12f, 0.12f,
-        
-            // Arka yüzey
-            -0.25f, -0.11f, -0.35f, 0.0f, 0.0f, -1.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.11f, -0.35f, 0.0f, 0.0f, -1.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.35f, 0.0f, 0.0f, -1.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.35f, 0.0f, 0.0f, -1.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.09f, -0.35f, 0.0f, 0.0f, -1.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.11f, -0.35f, 0.0f, 0.0f, -1.0f, 0.12f, 0.12f, 0.12f,
-        
-            // Sol yüzey
-            -0.25f, -0.11f, -0.35f, -1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.11f, -0.15f, -1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.09f, -0.15f, -1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.09f, -0.15f, -1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.09f, -0.35f, -1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            -0.25f, -0.11f, -0.35f, -1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-        
-            // Sağ yüzey
-            0.25f, -0.11f, -0.35f, 1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.11f, -0.15f, 1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.15f, 1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.15f, 1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.09f, -0.35f, 1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-            0.25f, -0.11f, -0.35f, 1.0f, 0.0f, 0.0f, 0.12f, 0.12f, 0.12f,
-        };
-
-
-    // Kitaplar (üst üste 3 kitap)
-    float bookVertices[] = {
-        // Birinci kitap (kırmızı kitap)
-        // pozisyonlar          // normallar         // renkler (kırmızı)
-        // Üst yüzey
-        -1.3f, -0.09f, 0.6f, 0.0f, 1.0f, 0.0f, 0.8f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.6f, 0.0f, 1.0f, 0.0f, 0.8f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.3f, 0.0f, 1.0f, 0.0f, 0.8f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.3f, 0.0f, 1.0f, 0.0f, 0.8f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.3f, 0.0f, 1.0f, 0.0f, 0.8f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.6f, 0.0f, 1.0f, 0.0f, 0.8f, 0.1f, 0.1f,
-
-        // Alt yüzey
-        -1.3f, -0.12f, 0.6f, 0.0f, -1.0f, 0.0f, 0.7f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.6f, 0.0f, -1.0f, 0.0f, 0.7f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.3f, 0.0f, -1.0f, 0.0f, 0.7f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.3f, 0.0f, -1.0f, 0.0f, 0.7f, 0.1f, 0.1f,
-        -1.3f, -0.12f, 0.3f, 0.0f, -1.0f, 0.0f, 0.7f, 0.1f, 0.1f,
-        -1.3f, -0.12f, 0.6f, 0.0f, -1.0f, 0.0f, 0.7f, 0.1f, 0.1f,
-
-        // Ön yüzey
-        -1.3f, -0.12f, 0.6f, 0.0f, 0.0f, 1.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.6f, 0.0f, 0.0f, 1.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.6f, 0.0f, 0.0f, 1.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.6f, 0.0f, 0.0f, 1.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.6f, 0.0f, 0.0f, 1.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.12f, 0.6f, 0.0f, 0.0f, 1.0f, 0.75f, 0.1f, 0.1f,
-
-        // Arka yüzey
-        -1.3f, -0.12f, 0.3f, 0.0f, 0.0f, -1.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.3f, 0.0f, 0.0f, -1.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.3f, 0.0f, 0.0f, -1.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.3f, 0.0f, 0.0f, -1.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.3f, 0.0f, 0.0f, -1.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.12f, 0.3f, 0.0f, 0.0f, -1.0f, 0.75f, 0.1f, 0.1f,
-
-        // Sol yüzey
-        -1.3f, -0.12f, 0.3f, -1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.12f, 0.6f, -1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.6f, -1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.6f, -1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.09f, 0.3f, -1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.3f, -0.12f, 0.3f, -1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-
-        // Sağ yüzey
-        -1.0f, -0.12f, 0.3f, 1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.6f, 1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.6f, 1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.6f, 1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.09f, 0.3f, 1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-        -1.0f, -0.12f, 0.3f, 1.0f, 0.0f, 0.0f, 0.75f, 0.1f, 0.1f,
-
-        // İkinci kitap (mavi kitap, birincinin üstünde)
-        // Üst yüzey
-        -1.25f, -0.05f, 0.55f, 0.0f, 1.0f, 0.0f, 0.1f, 0.1f, 0.8f,
-        -0.95f, -0.05f, 0.55f, 0.0f, 1.0f, 0.0f, 0.1f, 0.1f, 0.8f,
-        -0.95f, -0.05f, 0.35f, 0.0f, 1.0f, 0.0f, 0.1f, 0.1f, 0.8f,
-        -0.95f, -0.05f, 0.35f, 0.0f, 1.0f, 0.0f, 0.1f, 0.1f, 0.8f,
-        -1.25f, -0.05f, 0.35f, 0.0f, 1.0f, 0.0f, 0.1f, 0.1f, 0.8f,
-        -1.25f, -0.05f, 0.55f, 0.0f, 1.0f, 0.0f, 0.1f, 0.1f, 0.8f,
-
-        // Alt yüzey (bu, birinci kitabın üzerine oturuyor)
-        -1.25f, -0.09f, 0.55f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.7f,
-        -0.95f, -0.09f, 0.55f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.7f,
-        -0.95f, -0.09f, 0.35f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.7f,
-        -0.95f, -0.09f, 0.35f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.7f,
-        -1.25f, -0.09f, 0.35f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.7f,
-        -1.25f, -0.09f, 0.55f, 0.0f, -1.0f, 0.0f, 0.1f, 0.1f, 0.7f,
-
-        // Ön yüzey
-        -1.25f, -0.09f, 0.55f, 0.0f, 0.0f, 1.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.09f, 0.55f, 0.0f, 0.0f, 1.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.55f, 0.0f, 0.0f, 1.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.55f, 0.0f, 0.0f, 1.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.05f, 0.55f, 0.0f, 0.0f, 1.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.09f, 0.55f, 0.0f, 0.0f, 1.0f, 0.1f, 0.1f, 0.75f,
-
-        // Arka yüzey
-        -1.25f, -0.09f, 0.35f, 0.0f, 0.0f, -1.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.09f, 0.35f, 0.0f, 0.0f, -1.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.35f, 0.0f, 0.0f, -1.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.35f, 0.0f, 0.0f, -1.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.05f, 0.35f, 0.0f, 0.0f, -1.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.09f, 0.35f, 0.0f, 0.0f, -1.0f, 0.1f, 0.1f, 0.75f,
-
-        // Sol yüzey
-        -1.25f, -0.09f, 0.35f, -1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.09f, 0.55f, -1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.05f, 0.55f, -1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.05f, 0.55f, -1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.05f, 0.35f, -1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -1.25f, -0.09f, 0.35f, -1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-
-        // Sağ yüzey
-        -0.95f, -0.09f, 0.35f, 1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.09f, 0.55f, 1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.55f, 1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.55f, 1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.05f, 0.35f, 1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-        -0.95f, -0.09f, 0.35f, 1.0f, 0.0f, 0.0f, 0.1f, 0.1f, 0.75f,
-
-        // Üçüncü kitap (yeşil kitap, ikincinin üstünde)
-        // Üst yüzey
-        -1.2f, -0.01f, 0.5f, 0.0f, 1.0f, 0.0f, 0.1f, 0.7f, 0.3f,
-        -1.0f, -0.01f, 0.5f, 0.0f, 1.0f, 0.0f, 0.1f, 0.7f, 0.3f,
-        -1.0f, -0.01f, 0.4f, 0.0f, 1.0f, 0.0f, 0.1f, 0.7f, 0.3f,
-        -1.0f, -0.01f, 0.4f, 0.0f, 1.0f, 0.0f, 0.1f, 0.7f, 0.3f,
-        -1.2f, -0.01f, 0.4f, 0.0f, 1.0f, 0.0f, 0.1f, 0.7f, 0.3f,
-        -1.2f, -0.01f, 0.5f, 0.0f, 1.0f, 0.0f, 0.1f, 0.7f, 0.3f,
-
-        // Alt yüzey (bu, ikinci kitabın üzerine oturuyor)
-        -1.2f, -0.05f, 0.5f, 0.0f, -1.0f, 0.0f, 0.1f, 0.6f, 0.3f,
-        -1.0f, -0.05f, 0.5f, 0.0f, -1.0f, 0.0f, 0.1f, 0.6f, 0.3f,
-        -1.0f, -0.05f, 0.4f, 0.0f, -1.0f, 0.0f, 0.1f, 0.6f, 0.3f,
-        -1.0f, -0.05f, 0.4f, 0.0f, -1.0f, 0.0f, 0.1f, 0.6f, 0.3f,
-        -1.2f, -0.05f, 0.4f, 0.0f, -1.0f, 0.0f, 0.1f, 0.6f, 0.3f,
-        -1.2f, -0.05f, 0.5f, 0.0f, -1.0f, 0.0f, 0.1f, 0.6f, 0.3f,
-
-        // Ön yüzey
-        -1.2f, -0.05f, 0.5f, 0.0f, 0.0f, 1.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.05f, 0.5f, 0.0f, 0.0f, 1.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.5f, 0.0f, 0.0f, 1.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.5f, 0.0f, 0.0f, 1.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.01f, 0.5f, 0.0f, 0.0f, 1.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.05f, 0.5f, 0.0f, 0.0f, 1.0f, 0.1f, 0.65f, 0.3f,
-
-        // Arka yüzey
-        -1.2f, -0.05f, 0.4f, 0.0f, 0.0f, -1.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.05f, 0.4f, 0.0f, 0.0f, -1.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.4f, 0.0f, 0.0f, -1.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.4f, 0.0f, 0.0f, -1.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.01f, 0.4f, 0.0f, 0.0f, -1.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.05f, 0.4f, 0.0f, 0.0f, -1.0f, 0.1f, 0.65f, 0.3f,
-
-        // Sol yüzey
-        -1.2f, -0.05f, 0.4f, -1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.05f, 0.5f, -1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.01f, 0.5f, -1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.01f, 0.5f, -1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.01f, 0.4f, -1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.2f, -0.05f, 0.4f, -1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-
-        // Sağ yüzey
-        -1.0f, -0.05f, 0.4f, 1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.05f, 0.5f, 1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.5f, 1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.5f, 1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.01f, 0.4f, 1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f,
-        -1.0f, -0.05f, 0.4f, 1.0f, 0.0f, 0.0f, 0.1f, 0.65f, 0.3f};
-
-
-    // Masa VAO/VBO
-    unsigned int deskVAO, deskVBO;
-    glGenVertexArrays(1, &deskVAO);
-    glGenBuffers(1, &deskVBO);
-
-    glBindVertexArray(deskVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, deskVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(deskVertices), deskVertices, GL_STATIC_DRAW);
-
-    // Position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    // Normal attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    // Color attribute
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Masa bacağı VAO/VBO
-    unsigned int legVAO, legVBO;
-    glGenVertexArrays(1, &legVAO);
-    glGenBuffers(1, &legVBO);
-
-    glBindVertexArray(legVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, legVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(legVertices), legVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Monitör VAO/VBO
-    unsigned int monitorVAO, monitorVBO;
-    glGenVertexArrays(1, &monitorVAO);
-    glGenBuffers(1, &monitorVBO);
-
-    glBindVertexArray(monitorVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, monitorVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(monitorVertices), monitorVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Mouse VAO/VBO
-    unsigned int mouseVAO, mouseVBO;
-    glGenVertexArrays(1, &mouseVAO);
-    glGenBuffers(1, &mouseVBO);
-
-    glBindVertexArray(mouseVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, mouseVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(mouseVertices), mouseVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Klavye VAO/VBO
-    unsigned int keyboardVAO, keyboardVBO;
-    glGenVertexArrays(1, &keyboardVAO);
-    glGenBuffers(1, &keyboardVBO);
-
-    glBindVertexArray(keyboardVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, keyboardVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(keyboardVertices), keyboardVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Kitap VAO/VBO
-    unsigned int bookVAO, bookVBO;
-    glGenVertexArrays(1, &bookVAO);
-    glGenBuffers(1, &bookVBO);
-
-    glBindVertexArray(bookVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, bookVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(bookVertices), bookVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Kasa (computer case) VAO/VBO
-    float caseVertices[] = {
-        // Top face
-        -0.1f, 0.5f, -0.1f, 0.0f, 1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, -0.1f, 0.0f, 1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, 0.1f, 0.0f, 1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, 0.1f, 0.0f, 1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, 0.1f, 0.0f, 1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, -0.1f, 0.0f, 1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        // Bottom face
-        -0.1f, 0.0f, -0.1f, 0.0f, -1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, -0.1f, 0.0f, -1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, 0.1f, 0.0f, -1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, 0.1f, 0.0f, -1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.0f, 0.1f, 0.0f, -1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.0f, -0.1f, 0.0f, -1.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        // Front face
-        -0.1f, 0.0f, 0.1f, 0.0f, 0.0f, 1.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, 0.1f, 0.0f, 0.0f, 1.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, 0.1f, 0.0f, 0.0f, 1.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, 0.1f, 0.0f, 0.0f, 1.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, 0.1f, 0.0f, 0.0f, 1.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.0f, 0.1f, 0.0f, 0.0f, 1.0f, 0.7f, 0.7f, 0.7f,
-        // Back face
-        -0.1f, 0.0f, -0.1f, 0.0f, 0.0f, -1.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, -0.1f, 0.0f, 0.0f, -1.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, -0.1f, 0.0f, 0.0f, -1.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, -0.1f, 0.0f, 0.0f, -1.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, -0.1f, 0.0f, 0.0f, -1.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.0f, -0.1f, 0.0f, 0.0f, -1.0f, 0.7f, 0.7f, 0.7f,
-        // Left face
-        -0.1f, 0.0f, -0.1f, -1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.0f, 0.1f, -1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, 0.1f, -1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, 0.1f, -1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.5f, -0.1f, -1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        -0.1f, 0.0f, -0.1f, -1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        // Right face
-        0.1f, 0.0f, -0.1f, 1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, 0.1f, 1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, 0.1f, 1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, 0.1f, 1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.5f, -0.1f, 1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f,
-        0.1f, 0.0f, -0.1f, 1.0f, 0.0f, 0.0f, 0.7f, 0.7f, 0.7f};
-    unsigned int caseVAO, caseVBO;
-    glGenVertexArrays(1, &caseVAO);
-    glGenBuffers(1, &caseVBO);
-    glBindVertexArray(caseVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, caseVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(caseVertices), caseVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Yatak (bed) VAO/VBO
-    float bedVertices[] = {
-        // Top face
-        -0.5f, 0.1f, -0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, -0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, 0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, 0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, 0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, -0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        // Bottom face
-        -0.5f, 0.0f, -0.5f, 0.0f, -1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, -0.5f, 0.0f, -1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, 0.5f, 0.0f, -1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, 0.5f, 0.0f, -1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.0f, 0.5f, 0.0f, -1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.0f, -0.5f, 0.0f, -1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        // Front face
-        -0.5f, 0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, 0.5f, 0.0f, 0.0f, 1.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, 0.5f, 0.0f, 0.0f, 1.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, 0.5f, 0.0f, 0.0f, 1.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.8f, 0.8f, 0.8f,
-        // Back face
-        -0.5f, 0.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, -0.5f, 0.0f, 0.0f, -1.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, -0.5f, 0.0f, 0.0f, -1.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, -0.5f, 0.0f, 0.0f, -1.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.8f, 0.8f, 0.8f,
-        // Left face
-        -0.5f, 0.0f, -0.5f, -1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.0f, 0.5f, -1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, 0.5f, -1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, 0.5f, -1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.1f, -0.5f, -1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -0.5f, 0.0f, -0.5f, -1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        // Right face
-        0.5f, 0.0f, -0.5f, 1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, 0.5f, 1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, 0.5f, 1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.1f, -0.5f, 1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        0.5f, 0.0f, -0.5f, 1.0f, 0.0f, 0.0f, 0.8f, 0.8f, 0.8f};
-    unsigned int bedVAO, bedVBO;
-    glGenVertexArrays(1, &bedVAO);
-    glGenBuffers(1, &bedVBO);
-    glBindVertexArray(bedVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, bedVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(bedVertices), bedVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Çarşaf (sheet) VAO/VBO - kırmızı renkte, ince düzlem
-    float sheetVertices[] = {
-        // Tek yüzey (üst) - 6 vertex
-        -0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f,
-        0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f,
-        0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f,
-        0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f,
-        -0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f,
-        -0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.0f, 0.0f};
-    unsigned int sheetVAO, sheetVBO;
-    glGenVertexArrays(1, &sheetVAO);
-    glGenBuffers(1, &sheetVBO);
-    glBindVertexArray(sheetVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, sheetVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(sheetVertices), sheetVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Piramit için vertex verileri
-    float pyramidVertices[] = {
-        // Taban (2 üçgen)
-        2.5f, -1.0f, -1.0f,  0.0f, -1.0f, 0.0f,  0.7f, 0.4f, 0.2f,
-        1.5f, -1.0f, -1.0f,  0.0f, -1.0f, 0.0f,  0.7f, 0.4f, 0.2f,
-        1.5f, -1.0f, 0.0f,   0.0f, -1.0f, 0.0f,  0.7f, 0.4f, 0.2f,
-        
-        2.5f, -1.0f, -1.0f,  0.0f, -1.0f, 0.0f,  0.7f, 0.4f, 0.2f,
-        1.5f, -1.0f, 0.0f,   0.0f, -1.0f, 0.0f,  0.7f, 0.4f, 0.2f,
-        2.5f, -1.0f, 0.0f,   0.0f, -1.0f, 0.0f,  0.7f, 0.4f, 0.2f,
-        
-        // Ön yüz
-        2.0f, 0.5f, -0.5f,   0.0f, 0.5f, 1.0f,   0.8f, 0.5f, 0.3f,
-        2.5f, -1.0f, 0.0f,   0.0f, 0.5f, 1.0f,   0.8f, 0.5f, 0.3f,
-        1.5f, -1.0f, 0.0f,   0.0f, 0.5f, 1.0f,   0.8f, 0.5f, 0.3f,
-        
-        // Sağ yüz
-        2.0f, 0.5f, -0.5f,   1.0f, 0.5f, 0.0f,   0.7f, 0.4f, 0.2f,
-        2.5f, -1.0f, -1.0f,  1.0f, 0.5f, 0.0f,   0.7f, 0.4f, 0.2f,
-        2.5f, -1.0f, 0.0f,   1.0f, 0.5f, 0.0f,   0.7f, 0.4f, 0.2f,
-        
-        // Sol yüz
-        2.0f, 0.5f, -0.5f,   -1.0f, 0.5f, 0.0f,  0.8f, 0.5f, 0.3f,
-        1.5f, -1.0f, 0.0f,   -1.0f, 0.5f, 0.0f,  0.8f, 0.5f, 0.3f,
-        1.5f, -1.0f, -1.0f,  -1.0f, 0.5f, 0.0f,  0.8f, 0.5f, 0.3f,
-        
-        // Arka yüz
-        2.0f, 0.5f, -0.5f,   0.0f, 0.5f, -1.0f,  0.7f, 0.4f, 0.2f,
-        1.5f, -1.0f, -1.0f,  0.0f, 0.5f, -1.0f,  0.7f, 0.4f, 0.2f,
-        2.5f, -1.0f, -1.0f,  0.0f, 0.5f, -1.0f,  0.7f, 0.4f, 0.2f
-    };
-
-// Piramit VAO/VBO oluştur
-unsigned int pyramidVAO, pyramidVBO;
-glGenVertexArrays(1, &pyramidVAO);
-glGenBuffers(1, &pyramidVBO);
-
-glBindVertexArray(pyramidVAO);
-glBindBuffer(GL_ARRAY_BUFFER, pyramidVBO);
-glBufferData(GL_ARRAY_BUFFER, sizeof(pyramidVertices), pyramidVertices, GL_STATIC_DRAW);
-
-glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)0);
-glEnableVertexAttribArray(0);
-glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(3 * sizeof(float)));
-glEnableVertexAttribArray(1);
-glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(6 * sizeof(float)));
-glEnableVertexAttribArray(2);
-
-    // Oda tabanı (floor)
-    float floorVertices[] = {
-        -2.5f, -1.0f, -1.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        3.0f, -1.0f, -1.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        3.0f, -1.0f, 5.0f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        3.0f, -1.0f, 5.0f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -2.5f, -1.0f, 5.0f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f,
-        -2.5f, -1.0f, -1.5f, 0.0f, 1.0f, 0.0f, 0.8f, 0.8f, 0.8f};
-    unsigned int floorVAO, floorVBO;
-    glGenVertexArrays(1, &floorVAO);
-    glGenBuffers(1, &floorVBO);
-    glBindVertexArray(floorVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, floorVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(floorVertices), floorVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Sol duvar (left wall)
-    float leftWallVertices[] = {
-        -2.5f, -1.0f, -1.5f, 1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f, // Arka duvar hizasına çekildi
-        -2.5f, 5.0f, -1.5f, 1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f, // Arka duvar hizasına çekildi
-        -2.5f, 5.0f, 5.0f, 1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f,
-        -2.5f, 5.0f, 5.0f, 1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f,
-        -2.5f, -1.0f, 5.0f, 1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f,
-        -2.5f, -1.0f, -1.5f, 1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f  // Arka duvar hizasına çekildi
-    };
-    unsigned int leftWallVAO, leftWallVBO;
-    glGenVertexArrays(1, &leftWallVAO);
-    glGenBuffers(1, &leftWallVBO);
-    glBindVertexArray(leftWallVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, leftWallVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(leftWallVertices), leftWallVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // Sağ duvar (right wall)
-    float rightWallVertices[] = {
-        3.0f, -1.0f, -1.5f, -1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f, // Arka duvar hizasına çekildi
-        3.0f, 5.0f, -1.5f, -1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f, // Arka duvar hizasına çekildi
-        3.0f, 5.0f, 5.0f, -1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f,
-        3.0f, 5.0f, 5.0f, -1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f,
-        3.0f, -1.0f, 5.0f, -1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f,
-        3.0f, -1.0f, -1.5f, -1.0f, 0.0f, 0.0f, 0.6f, 0.3f, 0.1f  // Arka duvar hizasına çekildi
-    };
-    unsigned int rightWallVAO, rightWallVBO;
-    glGenVertexArrays(1, &rightWallVAO);
-    glGenBuffers(1, &rightWallVBO);
-    glBindVertexArray(rightWallVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, rightWallVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(rightWallVertices), rightWallVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    // Arka duvar (back wall)
-    float backWallVertices[] = {
-        -2.5f, -1.0f, -1.5f, 0.0f, 0.0f, 1.0f, 0.6f, 0.3f, 0.1f,
-        3.0f, -1.0f, -1.5f, 0.0f, 0.0f, 1.0f, 0.6f, 0.3f, 0.1f,
-        3.0f, 5.0f, -1.5f, 0.0f, 0.0f, 1.0f, 0.6f, 0.3f, 0.1f,
-        3.0f, 5.0f, -1.5f, 0.0f, 0.0f, 1.0f, 0.6f, 0.3f, 0.1f,
-        -2.5f, 5.0f, -1.5f, 0.0f, 0.0f, 1.0f, 0.6f, 0.3f, 0.1f,
-        -2.5f, -1.0f, -1.5f, 0.0f, 0.0f, 1.0f, 0.6f, 0.3f, 0.1f};
-    unsigned int backWallVAO, backWallVBO;
-    glGenVertexArrays(1, &backWallVAO);
-    glGenBuffers(1, &backWallVBO);
-    glBindVertexArray(backWallVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, backWallVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(backWallVertices), backWallVertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
+    // Yükleme sırasında GL doğrudan çağrıldı; önbellek buradan itibaren geçerli
+    glState().invalidate();
 
     // Ana döngü
+    double startTime = glfwGetTime();
+    unsigned int frameCount = 0;
     while (!glfwWindowShouldClose(window))
     {
         // Zaman hesaplaması
@@ -992,203 +328,407 @@ glEnableVertexAttribArray(2);
         // Input
         processInput(window);
 
+        glState().resetCounters();
+
         // Temizleme
         glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Aktive shader
-        glUseProgram(shaderProgram);
-
-        // Işık ayarları
-        glUniform3f(glGetUniformLocation(shaderProgram, "lightPos"), lightPos.x, lightPos.y, lightPos.z);
-        glUniform3f(glGetUniformLocation(shaderProgram, "viewPos"), cameraPos.x, cameraPos.y, cameraPos.z);
-        glUniform3f(glGetUniformLocation(shaderProgram, "lightColor"), 1.0f, 1.0f, 1.0f);
-
-        // View/Projection dönüşümleri
-        glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
-        glm::mat4 view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
-
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
-
-        // Masa üst kısmını çiz
-        glm::mat4 model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(0.0f, 0.0f, 0.0f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(deskVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 42); // 42 vertices for desk
-
-        // Masa bacakları
-        // Sol ön bacak
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(-1.3f, 0.0f, 0.6f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(legVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 24);
-
-        // Sağ ön bacak
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(1.3f, 0.0f, 0.6f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glDrawArrays(GL_TRIANGLES, 0, 24);
-
-        // Sol arka bacak
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(-1.3f, 0.0f, -0.6f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glDrawArrays(GL_TRIANGLES, 0, 24);
-
-        // Sağ arka bacak
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(1.3f, 0.0f, -0.6f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glDrawArrays(GL_TRIANGLES, 0, 24);
-
-        // Monitör
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(0.0f, 0.0f, 0.0f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(monitorVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 30);
-
-        // Mouse
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(0.4f, 0.0f, 0.4f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(mouseVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-
-        // Klavye
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(0.0f, 0.0f, 0.6f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(keyboardVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-
-        // Kasa (computer case)
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(1.0f, -0.1f, 0.2f)); // öne taşı
-        model = glm::scale(model, glm::vec3(1.0f, 1.1f, 1.5f));      // yandan daha uzun
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(caseVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-
-        // Kitaplar - 3 tane kitap için tüm vertex verisini çiz (6 üçgen x 6 yüz x 3 kitap = 108 üçgen)
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(0.0f, 0.0f, 0.0f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(bookVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 108); // 108 vertex (3 kitap, her kitap 6 yüz * 6 vertex)
-
-        // Yatak (bed)
-        model = glm::mat4(1.0f);
-        // Yatağı sağ duvara bitişik konumlandırır
-        model = glm::translate(model, glm::vec3(2.2f, -1.0f, 2.7f));
-        model = glm::rotate(model, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(2.5f, 5.0f, 1.5f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(bedVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-
-        // Çarşaf (sheet)
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(2.2f, -0.988f, 2.7f));
-        model = glm::rotate(model, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(2.5f, 1.0f, 1.5f));
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(sheetVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Oda tabanı (floor)
-        model = glm::mat4(1.0f);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(floorVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Sol duvar (left wall)
-        model = glm::mat4(1.0f);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(leftWallVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Sağ duvar (right wall)
-        model = glm::mat4(1.0f);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(rightWallVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Arka duvar (back wall)
-        model = glm::mat4(1.0f);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(backWallVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        // Ampulü çiz
-model = glm::mat4(1.0f);
-model = glm::translate(model, lightPos);
-model = glm::scale(model, glm::vec3(1.0f, 1.0f, 1.0f));
-glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-glBindVertexArray(lampVAO);
-
-// Taban çemberi için
-glDrawArrays(GL_TRIANGLE_FAN, 0, 10);
-
-// Koni yüzeyi için
-glDrawArrays(GL_TRIANGLE_FAN, 10, 10);
-
-// Metal kısım için
-glDrawArrays(GL_TRIANGLE_STRIP, 20, 6);
-
-        //Piramit
-        model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(-0.2f, 0.0f, -0.2f)); // Sağ arka köşeye taşı
-        model = glm::scale(model, glm::vec3(1.2f, 1.0f, 1.0f)); // Boyutlandır
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glBindVertexArray(pyramidVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 18); // 6 üçgen (taban için 2 + 4 yan yüz)
+        // Kare verisi (kamera + ışık)
+        FrameData frameData;
+        frameData.projection = glm::perspective(glm::radians(45.0f), (float)SCR_WIDTH / (float)SCR_HEIGHT, NEAR_PLANE, FAR_PLANE);
+        frameData.view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
+        frameData.viewProjection = frameData.projection * frameData.view;
+        frameData.lightPos = glm::vec4(lightPos, 1.0f);
+        frameData.viewPos = glm::vec4(cameraPos, 1.0f);
+        frameData.lightColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+        // Hareketli nesneler: ampul ışıkla birlikte
+        glm::mat4 lampModel = glm::mat4(1.0f);
+        lampModel = glm::translate(lampModel, lightPos);
+        lampModel = glm::scale(lampModel, glm::vec3(1.0f, 1.0f, 1.0f));
+        const float lodScale = lodPixelScale(glm::radians(45.0f), (float)SCR_HEIGHT);
+        occlusion.render(frameData.viewProjection, occlusionWorkers);
+        cells.update(cameraPos, extractFrustum(frameData.viewProjection));
+
+        if (useAzdo)
+        {
+            // Kare verisi ve dönüşümler eşlenmiş halkaya; bütün sahne tek çağrı
+            for (LodChain<size_t> &lod : lampCommandLods)
+            {
+                const size_t selected = lod.select(frameData.view, lampModel, lodScale);
+                for (size_t i = 0; i < lod.levelCount(); ++i)
+                    azdoRenderer.setCommandEnabled(lod.level(i), i == selected);
+            }
+            const glm::mat4 models[] = {glm::mat4(1.0f), lampModel}; // STATIC_DRAW_INDEX, LAMP_DRAW_INDEX
+            azdoRenderer.draw(frameData, models, 2, &occlusion, &cells);
+        }
+        else
+        {
+            // Kare verisi bütün programlar için tek yükleme
+            frameDataBuffer.update(frameData);
+
+            // Bütün model matrisleri önce toplanır, tek yüklemeyle gönderilir;
+            // çizimler sıralanmak üzere kuyruğa eklenir
+            transformBuffer.clear();
+            renderQueue.begin(NEAR_PLANE, FAR_PLANE);
+
+            RenderCommand draw;
+            draw.program = sceneProgramId;
+            draw.arena = &meshArena;
+
+            // Statik yığın: dünya uzayında, MeshArena::multiDraw ile tek
+            // glMultiDrawElementsBaseVertex; görüş hacmi dışındaki nesneler ve
+            // görünmeyen kümeler önce çizim listesinden çıkarılır, son sorgu
+            // sonucu örtülü olanlar koşullu çizime ayrılır
+            const Frustum frustum = extractFrustum(frameData.viewProjection);
+            if (USE_OCCLUSION_QUERIES)
+                occlusionQueries.collect();
+            staticBatch.cull(frustum, cameraPos, &occlusion, USE_OCCLUSION_QUERIES ? &occlusionQueries : nullptr, &cells);
+            RenderCommand staticDraw = draw;
+            staticDraw.batch = &staticBatch;
+            staticDraw.drawIndex = transformBuffer.push(glm::mat4(1.0f)); // STATIC_DRAW_INDEX
+            renderQueue.submit(staticDraw, 0.0f);
+
+            // Ampulün konisi ve metal kısmı, ekran hatasına göre seçilen seviyede;
+            // görüş hacminin dışındaysa, hücresine ulaşılmadıysa ya da örtülüyse
+            // hiç gönderilmez
+            draw.drawIndex = transformBuffer.push(lampModel); // LAMP_DRAW_INDEX
+            for (LodChain<MeshRange> &lod : lampLods)
+            {
+                draw.range = lod.level(lod.select(frameData.view, lampModel, lodScale));
+                const ObjectBounds bounds = transformBounds(boxBounds(draw.range.boundsMin, draw.range.boundsMax), lampModel);
+                if (!aabbInFrustum(frustum, bounds.boundsMin, bounds.boundsMax) ||
+                    !cells.visible(bounds.boundsMin, bounds.boundsMax) || !occlusion.visible(bounds.boundsMin, bounds.boundsMax))
+                    continue;
+                renderQueue.submit(draw, viewDepth(frameData.view, lampModel, draw.range));
+            }
+
+            transformBuffer.upload(frameData.viewProjection);
+            transformBuffer.bind();
+
+            // Durum değişikliklerine ve derinliğe göre sırala, çiz
+            renderQueue.sort();
+            renderQueue.execute();
+
+            if (USE_OCCLUSION_QUERIES)
+            {
+                // Vekil kutular ana geçişin derinliğine karşı: örtülü bilinenler her
+                // karede, görünürler sırası geldikçe. Sonra örtülü bilinenler kendi
+                // sorgularına bağlı koşullu çizimle gönderilir.
+                const std::vector<StaticBatch::Object> &objects = staticBatch.objectList();
+                occlusionQueries.beginProxies(frameData.viewProjection);
+                for (const StaticBatch::DeferredObject &d : staticBatch.deferredObjects())
+                    occlusionQueries.test(d.object, objects[d.object].bounds.boundsMin, objects[d.object].bounds.boundsMax);
+                for (size_t o : staticBatch.drawnObjects())
+                {
+                    if (occlusionQueries.retestDue(o))
+                        occlusionQueries.test(o, objects[o].bounds.boundsMin, objects[o].bounds.boundsMax);
+                }
+                occlusionQueries.endProxies();
+
+                shaderProgram.use();
+                glState().bindVertexArray(meshArena.vertexArray());
+                shaderProgram.set(drawIndexUniform, staticDraw.drawIndex);
+                for (const StaticBatch::DeferredObject &d : staticBatch.deferredObjects())
+                {
+                    const bool conditional = occlusionQueries.beginConditional(d.object);
+                    staticBatch.drawDeferred(d);
+                    if (conditional)
+                        occlusionQueries.endConditional();
+                }
+            }
+        }
+
         // Buffers
         glfwSwapBuffers(window);
         glfwPollEvents();
+        ++frameCount;
+    }
+
+    if (frameCount > 0)
+        std::cout << "Ortalama kare süresi: " << (glfwGetTime() - startTime) * 1000.0 / frameCount << " ms ("
+                  << frameCount << " kare)" << std::endl;
+
+    const CullStats &cullStats = useAzdo ? azdoRenderer.cullStats() : staticBatch.cullStats();
+    std::cout << "Görüş hacmi ayıklaması (son kare): " << cullStats.visibleObjects << " / " << cullStats.objects
+              << " nesne (" << cullStats.occludedObjects << " örtülü), " << cullStats.visibleClusters << " / " << cullStats.clusters << " küme çizildi" << std::endl;
+    if (useAzdo)
+    {
+        const Bvh &bvh = azdoRenderer.objectBvh();
+        std::cout << "BVH (son kare): " << bvh.itemCount() << " nesne, " << bvh.nodeCount() << " düğüm, SAH maliyeti "
+                  << bvh.sahCost() << std::endl;
     }
+    const PortalStats &portalStats = cells.portalStats();
+    std::cout << "Hücre/portal (son kare): " << portalStats.visibleCells << " / " << portalStats.cells << " hücre görünür, "
+              << portalStats.views << " portal hacmi, " << portalStats.portalsTested << " portal kırpıldı" << std::endl;
+    if (!useAzdo && USE_OCCLUSION_QUERIES)
+    {
+        const OcclusionQueryStats &queryStats = occlusionQueries.totalStats();
+        std::cout << "Donanım örtme sorguları: " << queryStats.issued << " sorgu, " << queryStats.conditional
+                  << " koşullu çizim, " << queryStats.results << " sonuç (" << queryStats.occluded << " örtülü, isabet %"
+                  << (queryStats.results ? 100 * queryStats.occluded / queryStats.results : 0) << "), "
+                  << queryStats.notReady << " hazır olmayan sonuç sonraki kareye kaldı (CPU beklemedi), "
+                  << queryStats.gpuWaits << " koşullu çizimde sorgu bitmemişti (GPU beklemesi)" << std::endl;
+    }
+    std::cout << "GL durum önbelleği (son kare): " << glState().issuedCount() << " çağrı, "
+              << glState().elidedCount() << " gereksiz çağrı atlandı" << std::endl;
 
     // Temizlik
-    glDeleteVertexArrays(1, &deskVAO);
-    glDeleteVertexArrays(1, &legVAO);
-    glDeleteVertexArrays(1, &monitorVAO);
-    glDeleteVertexArrays(1, &mouseVAO);
-    glDeleteVertexArrays(1, &keyboardVAO);
-    glDeleteVertexArrays(1, &bookVAO);
-    glDeleteVertexArrays(1, &caseVAO);
-    glDeleteVertexArrays(1, &bedVAO);
-    glDeleteVertexArrays(1, &sheetVAO);
-    glDeleteVertexArrays(1, &floorVAO);
-    glDeleteVertexArrays(1, &leftWallVAO);
-    glDeleteVertexArrays(1, &rightWallVAO);
-    glDeleteVertexArrays(1, &backWallVAO);
-    glDeleteVertexArrays(1, &lampVAO);
-    glDeleteVertexArrays(1, &pyramidVAO);
-    glDeleteBuffers(1, &pyramidVBO);
-    glDeleteBuffers(1, &deskVBO);
-    glDeleteBuffers(1, &legVBO);
-    glDeleteBuffers(1, &monitorVBO);
-    glDeleteBuffers(1, &mouseVBO);
-    glDeleteBuffers(1, &keyboardVBO);
-    glDeleteBuffers(1, &bookVBO);
-    glDeleteBuffers(1, &caseVBO);
-    glDeleteBuffers(1, &bedVBO);
-    glDeleteBuffers(1, &sheetVBO);
-    glDeleteBuffers(1, &floorVBO);
-    glDeleteBuffers(1, &leftWallVBO);
-    glDeleteBuffers(1, &rightWallVBO);
-    glDeleteBuffers(1, &backWallVBO);
-    glDeleteBuffers(1, &lampVBO);
-
-    glDeleteProgram(shaderProgram);
+    meshArena.destroy();
+
+    frameDataBuffer.destroy();
+    transformBuffer.destroy();
+    azdoRenderer.destroy();
+    if (!useAzdo && USE_OCCLUSION_QUERIES)
+        occlusionQueries.destroy();
+    shaderProgram.destroy();
 
     glfwTerminate();
     return 0;
 }
 
+#ifdef USE_VULKAN
+// Vulkan yolu: GL bağlamı olmayan pencere, aynı sahne, aynı kamera ve ışık
+int runVulkan()
+{
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Çalışma Masası Modeli (Vulkan)", NULL, NULL);
+    if (!window)
+    {
+        std::cerr << "Pencere oluşturulamadı!" << std::endl;
+        return -1;
+    }
+    glfwSetCursorPosCallback(window, mouse_callback);
+    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+
+    StaticBatch staticBatch;
+    std::vector<ProceduralMeshDesc> lampParts;
+    buildScene(staticBatch, lampParts);
+
+    // Statik yığın önceden kaydedilen komut tamponlarında, ampul her karede
+    VulkanRenderer renderer;
+    renderer.addStaticBatch(staticBatch);
+    std::vector<LodChain<size_t>> lampLods;
+    for (const ProceduralMeshDesc &part : lampParts)
+        lampLods.push_back(buildProceduralLods<size_t>(part, LAMP_LOD_LEVELS, [&](const ProceduralMeshDesc &level)
+                                                       { return renderer.addProcedural(level, LAMP_DRAW_INDEX); }));
+    const bool halfPositions = USE_HALF_POSITIONS && sceneFitsHalf(staticBatch, lampParts);
+    const bool created = withPositionLayout(halfPositions, [&](auto layout)
+                                            { return renderer.create<decltype(layout)>(window, "shaders/vulkan_scene.vert.spv",
+                                                                                       "shaders/vulkan_scene.frag.spv"); });
+    if (!created)
+    {
+        renderer.destroy();
+        glfwDestroyWindow(window);
+        return -1;
+    }
+    std::cout << "Renderer: Vulkan" << std::endl;
+
+    double startTime = glfwGetTime();
+    unsigned int frameCount = 0;
+    while (!glfwWindowShouldClose(window))
+    {
+        float currentFrame = glfwGetTime();
+        deltaTime = currentFrame - lastFrame;
+        lastFrame = currentFrame;
+
+        processInput(window);
+
+        // Kare verisi GL yoluyla aynı; sadece projeksiyon Vulkan kırpma uzayına çevrilir
+        const VkExtent2D extent = renderer.extent();
+        const float aspect = extent.height > 0 ? (float)extent.width / (float)extent.height : 1.0f;
+        FrameData frameData;
+        frameData.projection = vulkanClipCorrection() * glm::perspective(glm::radians(45.0f), aspect, NEAR_PLANE, FAR_PLANE);
+        frameData.view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
+        frameData.viewProjection = frameData.projection * frameData.view;
+        frameData.lightPos = glm::vec4(lightPos, 1.0f);
+        frameData.viewPos = glm::vec4(cameraPos, 1.0f);
+        frameData.lightColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+        const glm::mat4 lampModel = glm::translate(glm::mat4(1.0f), lightPos);
+        const float lodScale = lodPixelScale(glm::radians(45.0f), (float)extent.height);
+        for (LodChain<size_t> &lod : lampLods)
+        {
+            const size_t selected = lod.select(frameData.view, lampModel, lodScale);
+            for (size_t i = 0; i < lod.levelCount(); ++i)
+                renderer.setDrawEnabled(lod.level(i), i == selected);
+        }
+
+        const glm::mat4 models[] = {glm::mat4(1.0f), lampModel}; // STATIC_DRAW_INDEX, LAMP_DRAW_INDEX
+        renderer.draw(frameData, models, 2);
+        ++frameCount;
+
+        glfwPollEvents();
+    }
+
+    if (frameCount > 0)
+        std::cout << "Ortalama kare süresi: " << (glfwGetTime() - startTime) * 1000.0 / frameCount << " ms ("
+                  << frameCount << " kare)" << std::endl;
+
+    renderer.destroy();
+    glfwDestroyWindow(window);
+    return 0;
+}
+#endif
+
+// Odanın geometrisi: statik her şey staticBatch'e pişirilir, ampulün parçaları
+// (koni ve metal duy) prosedürel mesh tanımı olarak lampParts'a yazılır
+void buildScene(StaticBatch &staticBatch, std::vector<ProceduralMeshDesc> &lampParts)
+{
+    // Ampul: tabanı kapalı koni ve üstünde metal silindir (en ince LOD seviyesi)
+    lampParts.assign({coneMesh(0.1f, 0.2f, 32, glm::vec3(1.0f, 1.0f, 0.8f)),
+                      cylinderMesh(0.02f, 0.1f, 16, glm::vec3(0.7f, 0.7f, 0.7f), glm::vec3(0.0f, 0.2f, 0.0f))});
+
+    // Düz yüzeyli nesneler derleme zamanında kurulur (box_builder.h)
+    // Monitör: ekran (koyu siyah), çerçeve (gri), stand ve taban (koyu gri)
+    static constexpr auto monitorVertices = concat(
+        quad({-0.3f, 0.0f, -0.02f}, {0.3f, 0.0f, -0.02f}, {0.3f, 0.4f, -0.02f}, {-0.3f, 0.4f, -0.02f},
+             {0.0f, 0.0f, 1.0f}, {0.05f, 0.05f, 0.05f}),
+        quad({-0.32f, -0.02f, -0.03f}, {0.32f, -0.02f, -0.03f}, {0.32f, 0.42f, -0.03f}, {-0.32f, 0.42f, -0.03f},
+             {0.0f, 0.0f, 1.0f}, {0.3f, 0.3f, 0.3f}),
+        quad({-0.05f, -0.02f, -0.03f}, {0.05f, -0.02f, -0.03f}, {0.05f, -0.1f, -0.03f}, {-0.05f, -0.1f, -0.03f},
+             {0.0f, 0.0f, 1.0f}, {0.2f, 0.2f, 0.2f}),
+        quad({-0.15f, -0.09f, -0.03f}, {0.15f, -0.09f, -0.03f}, {0.15f, -0.09f, 0.1f}, {-0.15f, -0.09f, 0.1f},
+             {0.0f, 0.0f, 1.0f}, {0.2f, 0.2f, 0.2f}));
+    static_assert(vertexCount(monitorVertices) == 24, "Monitör 4 dörtgen olmalı");
+
+    // Çarşaf (sheet) - kırmızı renkte, ince düzlem (birim kare, yatak dönüşümüyle)
+    static constexpr auto sheetVertices =
+        quad({-0.5f, 0.5f, -0.5f}, {0.5f, 0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}, {-0.5f, 0.5f, 0.5f},
+             {0.0f, 1.0f, 0.0f}, {0.8f, 0.0f, 0.0f});
+
+    // Piramit: taban 2 üçgen, 4 yan yüz
+    static constexpr auto pyramidVertices =
+        pyramid({1.5f, -1.0f, -1.0f}, {2.5f, -1.0f, 0.0f}, {2.0f, 0.5f, -0.5f},
+                {0.7f, 0.4f, 0.2f}, {0.8f, 0.5f, 0.3f});
+    static_assert(vertexCount(pyramidVertices) == 18, "Piramit 6 üçgen olmalı");
+
+    // Oda tabanı ve duvarlar (dünya koordinatlarında)
+    static constexpr auto floorVertices =
+        quad({-2.5f, -1.0f, -1.5f}, {3.0f, -1.0f, -1.5f}, {3.0f, -1.0f, 5.0f}, {-2.5f, -1.0f, 5.0f},
+             {0.0f, 1.0f, 0.0f}, {0.8f, 0.8f, 0.8f});
+    static constexpr auto leftWallVertices =
+        quad({-2.5f, -1.0f, -1.5f}, {-2.5f, 5.0f, -1.5f}, {-2.5f, 5.0f, 5.0f}, {-2.5f, -1.0f, 5.0f},
+             {1.0f, 0.0f, 0.0f}, {0.6f, 0.3f, 0.1f});
+    static constexpr auto rightWallVertices =
+        quad({3.0f, -1.0f, -1.5f}, {3.0f, 5.0f, -1.5f}, {3.0f, 5.0f, 5.0f}, {3.0f, -1.0f, 5.0f},
+             {-1.0f, 0.0f, 0.0f}, {0.6f, 0.3f, 0.1f});
+    static constexpr auto backWallVertices =
+        quad({-2.5f, -1.0f, -1.5f}, {3.0f, -1.0f, -1.5f}, {3.0f, 5.0f, -1.5f}, {-2.5f, 5.0f, -1.5f},
+             {0.0f, 0.0f, 1.0f}, {0.6f, 0.3f, 0.1f});
+
+    // Hiç hareket etmeyen her şey yüklemede dünya uzayına pişirilir (statik yığın)
+    glm::mat4 model;
+
+    // Monitör
+    model = glm::mat4(1.0f);
+    model = glm::translate(model, glm::vec3(0.0f, 0.0f, 0.0f));
+    staticBatch.add(monitorVertices, model);
+
+    // Çarşaf (sheet)
+    model = glm::mat4(1.0f);
+    model = glm::translate(model, glm::vec3(2.2f, -0.988f, 2.7f));
+    model = glm::rotate(model, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    model = glm::scale(model, glm::vec3(2.5f, 1.0f, 1.5f));
+    staticBatch.add(sheetVertices, model);
+
+    // Oda (taban ve duvarlar) zaten dünya koordinatlarında; masayla birlikte
+    // yazılım örtme tamponunun örtücüleri
+    staticBatch.setOccluder(staticBatch.add(floorVertices));
+    staticBatch.setOccluder(staticBatch.add(leftWallVertices));
+    staticBatch.setOccluder(staticBatch.add(rightWallVertices));
+    staticBatch.setOccluder(staticBatch.add(backWallVertices));
+
+    //Piramit
+    model = glm::mat4(1.0f);
+    model = glm::translate(model, glm::vec3(-0.2f, 0.0f, -0.2f)); // Sağ arka köşeye taşı
+    model = glm::scale(model, glm::vec3(1.2f, 1.0f, 1.0f)); // Boyutlandır
+    staticBatch.add(pyramidVertices, model, true); // Tabanı da var: kapalı
+
+    // Kutu şeklindeki bütün mobilyalar: boxMesh() birim küpü kutunun dönüşümü ve
+    // yüz renkleriyle dünya uzayına çevirir, statik yığına pişmiş olarak eklenir
+    // Masa üst kısmı (kahverengi)
+    staticBatch.setOccluder(staticBatch.add(boxMesh(glm::vec3(-1.5f, -0.15f, -0.8f), glm::vec3(1.5f, -0.1f, 0.8f),
+                                                    glm::vec3(0.55f, 0.27f, 0.07f), glm::vec3(0.50f, 0.25f, 0.06f),
+                                                    glm::vec3(0.45f, 0.20f, 0.05f))));
+
+    // Masa bacakları (koyu kahverengi)
+    const glm::vec3 legPositions[] = {
+        glm::vec3(-1.3f, 0.0f, 0.6f),  // Sol ön bacak
+        glm::vec3(1.3f, 0.0f, 0.6f),   // Sağ ön bacak
+        glm::vec3(-1.3f, 0.0f, -0.6f), // Sol arka bacak
+        glm::vec3(1.3f, 0.0f, -0.6f),  // Sağ arka bacak
+    };
+    for (const glm::vec3 &legPosition : legPositions)
+        staticBatch.add(boxMesh(legPosition + glm::vec3(-0.05f, -0.8f, -0.05f), legPosition + glm::vec3(0.05f, 0.0f, 0.05f),
+                                glm::vec3(0.35f, 0.18f, 0.04f)));
+
+    // Mouse
+    staticBatch.add(boxMesh(glm::vec3(0.37f, -0.11f, 0.32f), glm::vec3(0.43f, -0.07f, 0.37f),
+                            glm::vec3(0.15f, 0.15f, 0.15f)));
+
+    // Klavye (siyah)
+    staticBatch.add(boxMesh(glm::vec3(-0.25f, -0.11f, 0.25f), glm::vec3(0.25f, -0.09f, 0.45f),
+                            glm::vec3(0.15f, 0.15f, 0.15f), glm::vec3(0.12f, 0.12f, 0.12f), glm::vec3(0.1f, 0.1f, 0.1f)));
+
+    // Kitaplar (üst üste 3 kitap: kırmızı, mavi, yeşil)
+    staticBatch.add(boxMesh(glm::vec3(-1.3f, -0.12f, 0.3f), glm::vec3(-1.0f, -0.09f, 0.6f),
+                            glm::vec3(0.8f, 0.1f, 0.1f), glm::vec3(0.75f, 0.1f, 0.1f), glm::vec3(0.7f, 0.1f, 0.1f)));
+    staticBatch.add(boxMesh(glm::vec3(-1.25f, -0.09f, 0.35f), glm::vec3(-0.95f, -0.05f, 0.55f),
+                            glm::vec3(0.1f, 0.1f, 0.8f), glm::vec3(0.1f, 0.1f, 0.75f), glm::vec3(0.1f, 0.1f, 0.7f)));
+    staticBatch.add(boxMesh(glm::vec3(-1.2f, -0.05f, 0.4f), glm::vec3(-1.0f, -0.01f, 0.5f),
+                            glm::vec3(0.1f, 0.7f, 0.3f), glm::vec3(0.1f, 0.65f, 0.3f), glm::vec3(0.1f, 0.6f, 0.3f)));
+
+    // Kasa (computer case)
+    glm::mat4 caseTransform = glm::mat4(1.0f);
+    caseTransform = glm::translate(caseTransform, glm::vec3(1.0f, -0.1f, 0.2f)); // öne taşı
+    caseTransform = glm::scale(caseTransform, glm::vec3(1.0f, 1.1f, 1.5f));      // yandan daha uzun
+    staticBatch.add(boxMesh(glm::vec3(-0.1f, 0.0f, -0.1f), glm::vec3(0.1f, 0.5f, 0.1f),
+                            glm::vec3(0.7f, 0.7f, 0.7f), caseTransform));
+
+    // Yatak (bed) - sağ duvara bitişik
+    glm::mat4 bedTransform = glm::mat4(1.0f);
+    bedTransform = glm::translate(bedTransform, glm::vec3(2.2f, -1.0f, 2.7f));
+    bedTransform = glm::rotate(bedTransform, glm::radians(-90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    bedTransform = glm::scale(bedTransform, glm::vec3(2.5f, 5.0f, 1.5f));
+    staticBatch.add(boxMesh(glm::vec3(-0.5f, 0.0f, -0.5f), glm::vec3(0.5f, 0.1f, 0.5f),
+                            glm::vec3(0.8f, 0.8f, 0.8f), bedTransform));
+}
+
+// Statik yığın dünya uzayında, ampulün parçaları kendi model uzayında (ışığın
+// konumu model matrisinde); ikisinin de sınırları half'a sığmalı
+bool sceneFitsHalf(const StaticBatch &staticBatch, const std::vector<ProceduralMeshDesc> &lampParts)
+{
+    for (const StaticBatch::Object &object : staticBatch.objectList())
+    {
+        if (!halfPositionsFit(object.bounds.boundsMin, object.bounds.boundsMax))
+            return false;
+    }
+    for (const ProceduralMeshDesc &part : lampParts)
+    {
+        glm::vec3 boundsMin, boundsMax;
+        proceduralMeshBounds(part, boundsMin, boundsMax);
+        if (!halfPositionsFit(boundsMin, boundsMax))
+            return false;
+    }
+    return true;
+}
+
+// Hücreler ve portallar: oda (taban ve duvarların kutusu) ve ön yüzünün
+// önündeki alan; odanın duvarsız ön yüzü (z = 5) ikisini bağlayan portal.
+// Duvarlar tek yüzlü ve tavan yok: dışarıdan duvarların arkası görünmez, bu
+// yüzden dış hücre sadece ön yüzün izdüşümü kadardır (oradan odaya her bakış
+// portaldan geçer); başka her yerde kamera hücresizdir ve her şey görünür.
+// Çok odalı sahnelerde her kapı boşluğu bir portal olarak eklenir.
+void buildCells(CellPortalGraph &cells)
+{
+    const size_t room = cells.addCell(glm::vec3(-2.5f, -1.0f, -1.5f), glm::vec3(3.0f, 5.0f, 5.0f));
+    const size_t outside = cells.addCell(glm::vec3(-2.5f, -1.0f, 5.0f), glm::vec3(3.0f, 5.0f, 50.0f));
+    cells.addPortal(room, outside, {glm::vec3(-2.5f, -1.0f, 5.0f), glm::vec3(3.0f, -1.0f, 5.0f),
+                                    glm::vec3(3.0f, 5.0f, 5.0f), glm::vec3(-2.5f, 5.0f, 5.0f)});
+}
+
 // Görüntü ekranı boyut değişimi
 void framebuffer_size_callback(GLFWwindow *window, int width, int height)
 {
@@ -1256,105 +796,22 @@ void processInput(GLFWwindow *window)
         cameraPos -= cameraUp * cameraSpeed;
 }
 
-// Küre oluşturma fonksiyonu
-std::vector<float> createSphereVertices(float radius, int sectorCount, int stackCount, glm::vec3 color)
+// Dosyadan shader yükleme (vertex + fragment)
+unsigned int loadShader(const char *vertexPath, const char *fragmentPath)
 {
-    std::vector<float> vertices;
-    float x, y, z, xy;                           // vertex position
-    float nx, ny, nz, lengthInv = 1.0f / radius; // normal
-
-    float sectorStep = 2 * M_PI / sectorCount;
-    float stackStep = M_PI / stackCount;
-    float sectorAngle, stackAngle;
-
-    for (int i = 0; i <= stackCount; ++i)
+    std::ifstream vertexFile(vertexPath);
+    std::ifstream fragmentFile(fragmentPath);
+    if (!vertexFile || !fragmentFile)
     {
-        stackAngle = M_PI / 2 - i * stackStep; // starting from pi/2 to -pi/2
-        xy = radius * cosf(stackAngle);        // r * cos(u)
-        z = radius * sinf(stackAngle);         // r * sin(u)
-
-        for (int j = 0; j < sectorCount; ++j)
-        {
-            sectorAngle = j * sectorStep; // starting from 0 to 2pi
-
-            x = xy * cosf(sectorAngle); // r * cos(u) * cos(v)
-            y = xy * sinf(sectorAngle); // r * cos(u) * sin(v)
-            vertices.push_back(x);
-            vertices.push_back(y);
-            vertices.push_back(z);
-
-            nx = x * lengthInv;
-            ny = y * lengthInv;
-            nz = z * lengthInv;
-            vertices.push_back(nx);
-            vertices.push_back(ny);
-            vertices.push_back(nz);
-
-            // Renk bilgisi ekliyoruz
-            vertices.push_back(color.r);
-            vertices.push_back(color.g);
-            vertices.push_back(color.b);
-        }
+        std::cerr << "ERROR::SHADER::FILE_NOT_READ: " << (vertexFile ? fragmentPath : vertexPath) << std::endl;
+        return 0;
     }
-    return vertices;
-}
 
-std::vector<unsigned int> createSphereIndices(int sectorCount, int stackCount)
-{
-    std::vector<unsigned int> indices;
-    int k1, k2;
-
-    for (int i = 0; i < stackCount; ++i)
-    {
-        k1 = i * (sectorCount + 1); // beginning of current stack
-        k2 = k1 + sectorCount + 1;  // beginning of next stack
-
-        for (int j = 0; j < sectorCount; ++j, ++k1, ++k2)
-        {
-            if (i != 0)
-            {
-                indices.push_back(k1);
-                indices.push_back(k2);
-                indices.push_back(k1 + 1);
-            }
+    std::stringstream vertexStream, fragmentStream;
+    vertexStream << vertexFile.rdbuf();
+    fragmentStream << fragmentFile.rdbuf();
 
-            if (i != (stackCount - 1))
-            {
-                indices.push_back(k1 + 1);
-                indices.push_back(k2);
-                indices.push_back(k2 + 1);
-            }
-        }
-    }
-    return indices;
+    std::string vertexCode = vertexStream.str();
+    std::string fragmentCode = fragmentStream.str();
+    return createShaderProgram(vertexCode.c_str(), fragmentCode.c_str());
 }
-
-unsigned int createSphere(float radius, int sectorCount, int stackCount, glm::vec3 color)
-{
-    std::vector<float> vertices = createSphereVertices(radius, sectorCount, stackCount, color);
-    std::vector<unsigned int> indices = createSphereIndices(sectorCount, stackCount);
-
-    unsigned int VAO, VBO, EBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void *)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    glBindVertexArray(0);
-
-    return VAO;
-}
\ No newline at end of file
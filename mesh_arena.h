@@ -0,0 +1,271 @@
+#ifndef MESH_ARENA_H
+#define MESH_ARENA_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "gl_state.h"
+#include "mesh_weld.h"
+#include "procedural_mesh.h"
+#include "vertex_format.h"
+
+// Bir meshin ortak vertex arenası içindeki yeri
+struct MeshRange
+{
+    GLint firstVertex = 0;
+    GLsizei vertexCount = 0;
+    GLint firstIndex = 0;   // İndeksli meshlerde indeks tamponundaki ilk indeks
+    GLsizei indexCount = 0; // 0 ise mesh glDrawArrays ile çizilir
+    glm::vec3 boundsMin = glm::vec3(0.0f); // Model uzayında eksen hizalı sınır kutusu
+    glm::vec3 boundsMax = glm::vec3(0.0f);
+};
+
+// Bütün statik meshleri tek bir VBO ve tek bir VAO içinde toplayan arena.
+// Meshler yükleme sırasında add() / addProcedural() ile eklenir, upload() ile
+// GPU'ya bir kere gönderilir. Çizimde sadece bir kez bind() yapılır, geri kalan
+// her şey (firstVertex, vertexCount) ofsetleriyle çizilir.
+//
+// Tamponlar tam boyutta bir kere ayrılır. CPU'daki meshler eşlenmiş belleğe
+// dönüştürülerek kopyalanır; prosedürel meshler CPU'da hiç tutulmaz, upload()
+// sırasında doğrudan eşlenmiş belleğe (iş parçacıklarıyla) üretilir.
+class MeshArena
+{
+public:
+    // pozisyon (3) + normal (3) + renk (3)
+    static const int FLOATS_PER_VERTEX = 9;
+
+    MeshRange add(const float *data, size_t floatCount)
+    {
+        MeshRange range;
+        range.firstVertex = (GLint)vertexTotal;
+        range.vertexCount = (GLsizei)(floatCount / FLOATS_PER_VERTEX);
+        appendSpan(vertexSpans, vertices.size() / FLOATS_PER_VERTEX, vertexTotal, range.vertexCount);
+        vertices.insert(vertices.end(), data, data + floatCount);
+        vertexTotal += range.vertexCount;
+
+        if (range.vertexCount > 0)
+        {
+            range.boundsMin = range.boundsMax = glm::vec3(data[0], data[1], data[2]);
+            for (size_t i = FLOATS_PER_VERTEX; i + 2 < floatCount; i += FLOATS_PER_VERTEX)
+            {
+                glm::vec3 p(data[i], data[i + 1], data[i + 2]);
+                range.boundsMin = glm::min(range.boundsMin, p);
+                range.boundsMax = glm::max(range.boundsMax, p);
+            }
+        }
+        return range;
+    }
+
+    // Sabit boyutlu diziler için: vertex sayısı elle yazılmak zorunda kalmasın
+    template <size_t N>
+    MeshRange add(const float (&data)[N])
+    {
+        return add(data, N);
+    }
+
+    // Kaynaklanmış bir meshi ekler; indeksler meshin kendi ilk vertexine göredir
+    MeshRange addIndexed(const WeldedMesh &mesh)
+    {
+        MeshRange range = add(mesh.vertices.data(), mesh.vertices.size());
+        range.firstIndex = (GLint)indexTotal;
+        range.indexCount = (GLsizei)mesh.indices.size();
+        appendSpan(indexSpans, indices.size(), indexTotal, mesh.indices.size());
+        indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+        indexTotal += mesh.indices.size();
+        for (uint32_t i : mesh.indices)
+            maxIndex = i > maxIndex ? i : maxIndex;
+        return range;
+    }
+
+    // Prosedürel bir meshin yerini ayırır (indeksli, GL_TRIANGLES). Boyutlar
+    // tanımdan hesaplanır; vertexler upload() sırasında üretilir.
+    MeshRange addProcedural(const ProceduralMeshDesc &desc)
+    {
+        const ProceduralMeshSize size = proceduralMeshSize(desc);
+        MeshRange range;
+        range.firstVertex = (GLint)vertexTotal;
+        range.vertexCount = (GLsizei)size.vertexCount;
+        range.firstIndex = (GLint)indexTotal;
+        range.indexCount = (GLsizei)size.indexCount;
+        proceduralMeshBounds(desc, range.boundsMin, range.boundsMax);
+
+        procedural.push_back({desc, vertexTotal, indexTotal});
+        vertexTotal += size.vertexCount;
+        indexTotal += size.indexCount;
+        proceduralVertexCount += size.vertexCount;
+        if (size.vertexCount > 0 && size.vertexCount - 1 > maxIndex)
+            maxIndex = (uint32_t)(size.vertexCount - 1);
+        return range;
+    }
+
+    template <class Layout = FloatVertexLayout>
+    void upload()
+    {
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, vertexTotal * Layout::stride, NULL, GL_STATIC_DRAW);
+        Layout::setup();
+
+        std::cout << "Vertex düzeni: " << Layout::stride << " bayt/vertex" << std::endl;
+
+        if (indexTotal > 0)
+        {
+            // İndeksler mesh başına göreli olduğu için hepsi 65536'dan küçükse 16 bit yeter
+            indexType = maxIndex <= 0xFFFF ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+            indexSize = maxIndex <= 0xFFFF ? sizeof(uint16_t) : sizeof(uint32_t);
+
+            glGenBuffers(1, &ebo);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexTotal * indexSize, NULL, GL_STATIC_DRAW);
+        }
+
+        if (indexType == GL_UNSIGNED_SHORT)
+            fillBuffers<Layout, uint16_t>();
+        else
+            fillBuffers<Layout, uint32_t>();
+
+        glBindVertexArray(0);
+
+        if (!procedural.empty())
+            std::cout << "Prosedürel: " << procedural.size() << " mesh, " << proceduralVertexCount
+                      << " vertex doğrudan GPU belleğine üretildi" << std::endl;
+
+        // Veri artık GPU'da, CPU kopyasına gerek yok
+        std::vector<float>().swap(vertices);
+        std::vector<uint32_t>().swap(indices);
+        std::vector<ArenaSpan>().swap(vertexSpans);
+        std::vector<ArenaSpan>().swap(indexSpans);
+        std::vector<ProceduralMeshTarget>().swap(procedural);
+    }
+
+    void bind() const
+    {
+        glState().bindVertexArray(vao);
+    }
+
+    GLuint vertexArray() const
+    {
+        return vao;
+    }
+
+    void draw(const MeshRange &range, GLenum mode = GL_TRIANGLES) const
+    {
+        if (range.indexCount > 0)
+            glDrawElementsBaseVertex(mode, range.indexCount, indexType,
+                                     (void *)(range.firstIndex * indexSize), range.firstVertex);
+        else
+            glDrawArrays(mode, range.firstVertex, range.vertexCount);
+    }
+
+    // İndeksli bir meshin alt aralıklarını (indeks cinsinden ilk indeks + sayı)
+    // tek çağrıda çizer; hepsi meshin ilk vertexini temel alır
+    void multiDraw(const MeshRange &range, const GLint *firstIndices, const GLsizei *counts, GLsizei drawCount,
+                   GLenum mode = GL_TRIANGLES) const
+    {
+        offsets.resize(drawCount);
+        baseVertices.assign(drawCount, range.firstVertex);
+        for (GLsizei i = 0; i < drawCount; ++i)
+            offsets[i] = (const void *)(firstIndices[i] * indexSize);
+        glMultiDrawElementsBaseVertex(mode, counts, indexType, offsets.data(), drawCount, baseVertices.data());
+    }
+
+    void destroy()
+    {
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &vbo);
+        glDeleteBuffers(1, &ebo);
+        vao = vbo = ebo = 0;
+    }
+
+private:
+    // CPU verisinin (source) tampondaki yeri (target), eleman cinsinden
+    struct ArenaSpan
+    {
+        size_t source;
+        size_t target;
+        size_t count;
+    };
+
+    // Ardışık eklemeler tek bir aralıkta birleşir
+    static void appendSpan(std::vector<ArenaSpan> &spans, size_t source, size_t target, size_t count)
+    {
+        if (count == 0)
+            return;
+        if (!spans.empty())
+        {
+            ArenaSpan &last = spans.back();
+            if (last.source + last.count == source && last.target + last.count == target)
+            {
+                last.count += count;
+                return;
+            }
+        }
+        spans.push_back({source, target, count});
+    }
+
+    static void *mapBuffer(GLenum target, size_t size)
+    {
+        if (size == 0)
+            return NULL;
+        return glMapBufferRange(target, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    }
+
+    static void unmapBuffer(GLenum target, void *data)
+    {
+        if (data != NULL && glUnmapBuffer(target) == GL_FALSE)
+            std::cerr << "ERROR::MESH_ARENA::BUFFER_CORRUPTED" << std::endl;
+    }
+
+    // Bağlı VBO ve EBO'yu eşleyip bütün meshleri yazar
+    template <class Layout, class Index>
+    void fillBuffers()
+    {
+        unsigned char *gpuVertices = (unsigned char *)mapBuffer(GL_ARRAY_BUFFER, vertexTotal * Layout::stride);
+        Index *gpuIndices = (Index *)mapBuffer(GL_ELEMENT_ARRAY_BUFFER, indexTotal * sizeof(Index));
+        if ((vertexTotal > 0 && gpuVertices == NULL) || (indexTotal > 0 && gpuIndices == NULL))
+        {
+            std::cerr << "ERROR::MESH_ARENA::MAP_FAILED" << std::endl;
+            unmapBuffer(GL_ARRAY_BUFFER, gpuVertices);
+            unmapBuffer(GL_ELEMENT_ARRAY_BUFFER, gpuIndices);
+            return;
+        }
+
+        for (const ArenaSpan &span : vertexSpans)
+            convertVerticesInto<Layout>(&vertices[span.source * FLOATS_PER_VERTEX], span.count,
+                                        gpuVertices + span.target * Layout::stride);
+        for (const ArenaSpan &span : indexSpans)
+            for (size_t i = 0; i < span.count; ++i)
+                gpuIndices[span.target + i] = (Index)indices[span.source + i];
+
+        writeProceduralMeshes<Layout, Index>(procedural, gpuVertices, gpuIndices);
+
+        unmapBuffer(GL_ARRAY_BUFFER, gpuVertices);
+        unmapBuffer(GL_ELEMENT_ARRAY_BUFFER, gpuIndices);
+    }
+
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<ArenaSpan> vertexSpans;
+    std::vector<ArenaSpan> indexSpans;
+    std::vector<ProceduralMeshTarget> procedural;
+    size_t vertexTotal = 0;
+    size_t indexTotal = 0;
+    uint32_t maxIndex = 0;
+    size_t proceduralVertexCount = 0;
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    GLuint ebo = 0;
+    GLenum indexType = GL_UNSIGNED_SHORT;
+    size_t indexSize = sizeof(uint16_t);
+    mutable std::vector<const void *> offsets; // multiDraw'ın her karede yeniden kullanılan dizileri
+    mutable std::vector<GLint> baseVertices;
+};
+
+#endif
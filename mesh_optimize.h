@@ -0,0 +1,383 @@
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+// İndeksli meshler için üç aşamalı sıralama (hepsi yerinde, 9 float'lık vertex):
+//  1. optimizeVertexCache: Forsyth'in doğrusal zamanlı algoritması; üçgenleri
+//     dönüştürülmüş vertexleri önbellekte en çok yeniden kullanacak sırada dizer;
+//  2. optimizeOverdraw: sırayı önbellek açısından kopmadan bölünebilen
+//     kümelere ayırır, dışa bakan kümeleri öne alır (önce çizilen ön yüzler
+//     arkadakileri derinlik testinde eler);
+//  3. optimizeVertexFetch: vertexleri ilk kullanım sırasına dizer; vertex
+//     okumaları bellekte ardışık olur.
+// analyzeVertexCache FIFO ya da LRU bir post-transform önbelleği simüle eder.
+
+// Önbellek simülasyonu sonucu
+struct VertexCacheStats
+{
+    size_t triangles = 0;
+    size_t transformed = 0; // Önbellek ıskası: vertex shader çalıştırma sayısı
+    size_t vertices = 0;    // Kullanılan farklı vertex sayısı
+
+    // Üçgen başına dönüştürülen vertex (0.5 ideal, 3 en kötü)
+    float acmr() const
+    {
+        return triangles > 0 ? (float)transformed / (float)triangles : 0.0f;
+    }
+
+    // Vertex başına dönüştürme (1 ideal)
+    float atvr() const
+    {
+        return vertices > 0 ? (float)transformed / (float)vertices : 0.0f;
+    }
+
+    VertexCacheStats &operator+=(const VertexCacheStats &other)
+    {
+        triangles += other.triangles;
+        transformed += other.transformed;
+        vertices += other.vertices;
+        return *this;
+    }
+};
+
+enum VertexCacheKind
+{
+    VERTEX_CACHE_FIFO, // Eski donanım: sadece ıskada girilir, en eski çıkar
+    VERTEX_CACHE_LRU,  // İsabet de girdiyi tazeler
+};
+
+const unsigned SIMULATED_CACHE_SIZE = 16;
+
+inline VertexCacheStats analyzeVertexCache(const uint32_t *indices, size_t indexCount, size_t vertexCount,
+                                           VertexCacheKind kind = VERTEX_CACHE_FIFO, unsigned cacheSize = SIMULATED_CACHE_SIZE)
+{
+    VertexCacheStats stats;
+    stats.triangles = indexCount / 3;
+
+    std::vector<bool> used(vertexCount, false);
+    std::vector<uint32_t> cache; // Baş en yeni
+    cache.reserve(cacheSize + 1);
+    for (size_t i = 0; i < indexCount; ++i)
+    {
+        const uint32_t v = indices[i];
+        if (!used[v])
+            used[v] = true, ++stats.vertices;
+
+        auto it = std::find(cache.begin(), cache.end(), v);
+        if (it != cache.end())
+        {
+            if (kind == VERTEX_CACHE_LRU)
+            {
+                cache.erase(it);
+                cache.insert(cache.begin(), v);
+            }
+            continue;
+        }
+        ++stats.transformed;
+        cache.insert(cache.begin(), v);
+        if (cache.size() > cacheSize)
+            cache.pop_back();
+    }
+    return stats;
+}
+
+namespace optimize_detail
+{
+    // Forsyth'in ağırlıkları
+    const int CACHE_SIZE = 32;
+    const float CACHE_DECAY_POWER = 1.5f;
+    const float LAST_TRIANGLE_SCORE = 0.75f;
+    const float VALENCE_BOOST_SCALE = 2.0f;
+    const float VALENCE_BOOST_POWER = 0.5f;
+
+    inline float vertexScore(int cachePosition, uint32_t remainingTriangles)
+    {
+        if (remainingTriangles == 0)
+            return -1.0f;
+
+        float score = 0.0f;
+        if (cachePosition >= 0)
+        {
+            // Son üçgenin vertexleri sabit puan alır; yoksa sıra bozulmaz
+            if (cachePosition < 3)
+                score = LAST_TRIANGLE_SCORE;
+            else
+                score = std::pow(1.0f - (float)(cachePosition - 3) / (CACHE_SIZE - 3), CACHE_DECAY_POWER);
+        }
+        // Az üçgeni kalan vertexler öne çekilir (yalnız kalan üçgen bırakmamak için)
+        return score + VALENCE_BOOST_SCALE * std::pow((float)remainingTriangles, -VALENCE_BOOST_POWER);
+    }
+
+    // Sıralı üçgenleri önbellek ıskası üç köşede de olan yerlerden (önbellek
+    // tamamen boşalmış) "sert" kümelere böler
+    inline std::vector<size_t> hardBoundaries(const uint32_t *indices, size_t indexCount, size_t vertexCount)
+    {
+        std::vector<size_t> boundaries;
+        std::vector<size_t> stamps(vertexCount, 0);
+        size_t timestamp = SIMULATED_CACHE_SIZE + 1;
+        for (size_t t = 0; t < indexCount / 3; ++t)
+        {
+            int misses = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                const uint32_t v = indices[t * 3 + k];
+                if (timestamp - stamps[v] > SIMULATED_CACHE_SIZE)
+                    stamps[v] = timestamp++, ++misses;
+            }
+            if (t == 0 || misses == 3)
+                boundaries.push_back(t);
+        }
+        return boundaries;
+    }
+}
+
+// Üçgenleri vertex önbelleğine göre yeniden sıralar (Forsyth). indices yerinde
+// değişir; üçgenlerin kendileri ve sarma yönleri aynı kalır.
+inline void optimizeVertexCache(uint32_t *indices, size_t indexCount, size_t vertexCount)
+{
+    using namespace optimize_detail;
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Vertex -> üçgenler (CSR)
+    std::vector<uint32_t> remaining(vertexCount, 0), offsets(vertexCount + 1, 0), adjacency(triangleCount * 3);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+        ++remaining[indices[i]];
+    for (size_t v = 0; v < vertexCount; ++v)
+        offsets[v + 1] = offsets[v] + remaining[v];
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+        adjacency[fill[indices[i]]++] = (uint32_t)(i / 3);
+
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v)
+        vertexScores[v] = vertexScore(-1, remaining[v]);
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<uint32_t> cache, nextCache;
+    cache.reserve(CACHE_SIZE + 3);
+    nextCache.reserve(CACHE_SIZE + 3);
+
+    size_t cursor = 0; // Çıkmazda sıradaki yayılmamış üçgen (girdi sırasıyla)
+    int best = 0;
+    while (best >= 0)
+    {
+        const uint32_t *tri = &indices[best * 3];
+        output.insert(output.end(), tri, tri + 3);
+        emitted[best] = true;
+
+        // Üçgeni köşelerin listesinden çıkar
+        for (int k = 0; k < 3; ++k)
+        {
+            const uint32_t v = tri[k];
+            uint32_t *begin = &adjacency[offsets[v]], *end = begin + remaining[v];
+            std::remove(begin, end, (uint32_t)best);
+            --remaining[v];
+        }
+
+        // Yeni vertexler öne, diğerleri sırayla arkaya; fazlası düşer
+        nextCache.assign(tri, tri + 3);
+        for (uint32_t v : cache)
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+                nextCache.push_back(v);
+        for (size_t i = CACHE_SIZE; i < nextCache.size(); ++i)
+            vertexScores[nextCache[i]] = vertexScore(-1, remaining[nextCache[i]]);
+        if (nextCache.size() > (size_t)CACHE_SIZE)
+            nextCache.resize(CACHE_SIZE);
+        cache.swap(nextCache);
+
+        // Önbellekteki vertexlerin ve üçgenlerinin puanları güncellenir; en
+        // iyi üçgen sadece bunlar arasından aranır
+        best = -1;
+        float bestScore = -1.0f;
+        for (size_t i = 0; i < cache.size(); ++i)
+            vertexScores[cache[i]] = vertexScore((int)i, remaining[cache[i]]);
+        for (uint32_t v : cache)
+            for (uint32_t i = offsets[v]; i < offsets[v] + remaining[v]; ++i)
+            {
+                const uint32_t t = adjacency[i];
+                const float score = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+                if (score > bestScore || (score == bestScore && (int)t < best))
+                    best = (int)t, bestScore = score;
+            }
+
+        // Çıkmaz: önbellekte üçgeni kalan vertex yok
+        if (best < 0)
+        {
+            while (cursor < triangleCount && emitted[cursor])
+                ++cursor;
+            if (cursor < triangleCount)
+                best = (int)cursor;
+        }
+    }
+    std::memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+// Önbellek sırasını bozmadan bölünebilen kümeleri dışa bakanlar öne gelecek
+// şekilde sıralar (Sander, Nehab, Barczak: "Fast Triangle Reordering"). Bir
+// küme, ıska oranı bütün kümenin threshold katını geçmeyecek kadar küçük
+// parçalara bölünür; threshold 1.05 önbellek verimini en fazla %5 düşürür.
+inline void optimizeOverdraw(uint32_t *indices, size_t indexCount, const float *vertices, size_t vertexCount, float threshold = 1.05f)
+{
+    using namespace optimize_detail;
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0)
+        return;
+
+    // Sert kümeler yumuşak sınırlarla küçültülür
+    const std::vector<size_t> hard = hardBoundaries(indices, indexCount, vertexCount);
+    std::vector<size_t> clusters;
+    std::vector<size_t> stamps(vertexCount, 0);
+    size_t timestamp = SIMULATED_CACHE_SIZE + 1;
+    for (size_t h = 0; h < hard.size(); ++h)
+    {
+        const size_t begin = hard[h], end = h + 1 < hard.size() ? hard[h + 1] : triangleCount;
+        auto misses = [&](size_t t)
+        {
+            int count = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                const uint32_t v = indices[t * 3 + k];
+                if (timestamp - stamps[v] > SIMULATED_CACHE_SIZE)
+                    stamps[v] = timestamp++, ++count;
+            }
+            return count;
+        };
+
+        timestamp += SIMULATED_CACHE_SIZE + 1; // Önbelleği boşalt
+        size_t clusterMisses = 0;
+        for (size_t t = begin; t < end; ++t)
+            clusterMisses += misses(t);
+        const float clusterThreshold = threshold * (float)clusterMisses / (float)(end - begin);
+
+        timestamp += SIMULATED_CACHE_SIZE + 1;
+        clusters.push_back(begin);
+        size_t start = begin, runningMisses = 0;
+        for (size_t t = begin; t < end; ++t)
+        {
+            runningMisses += misses(t);
+            if (t + 1 < end && (float)runningMisses / (float)(t - start + 1) <= clusterThreshold)
+            {
+                clusters.push_back(t + 1);
+                start = t + 1;
+                runningMisses = 0;
+                timestamp += SIMULATED_CACHE_SIZE + 1;
+            }
+        }
+    }
+
+    // Küme başına alan ağırlıklı merkez ve normal; anahtar, kümenin meshin
+    // merkezinden dışarı ne kadar baktığı
+    auto position = [&](uint32_t v) { return glm::vec3(vertices[v * 9], vertices[v * 9 + 1], vertices[v * 9 + 2]); };
+    glm::vec3 meshCenter(0.0f);
+    float meshArea = 0.0f;
+    std::vector<glm::vec3> centers(clusters.size(), glm::vec3(0.0f)), normals(clusters.size(), glm::vec3(0.0f));
+    std::vector<float> areas(clusters.size(), 0.0f);
+    for (size_t c = 0; c < clusters.size(); ++c)
+    {
+        const size_t end = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+        for (size_t t = clusters[c]; t < end; ++t)
+        {
+            const glm::vec3 p0 = position(indices[t * 3]), p1 = position(indices[t * 3 + 1]), p2 = position(indices[t * 3 + 2]);
+            const glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+            const float area = glm::length(n);
+            centers[c] += (p0 + p1 + p2) * (area / 3.0f);
+            normals[c] += n;
+            areas[c] += area;
+        }
+        meshCenter += centers[c];
+        meshArea += areas[c];
+    }
+    if (meshArea > 0.0f)
+        meshCenter /= meshArea;
+
+    std::vector<float> keys(clusters.size());
+    std::vector<uint32_t> order(clusters.size());
+    for (size_t c = 0; c < clusters.size(); ++c)
+    {
+        const glm::vec3 center = areas[c] > 0.0f ? centers[c] / areas[c] : meshCenter;
+        const float length = glm::length(normals[c]);
+        keys[c] = length > 0.0f ? glm::dot(center - meshCenter, normals[c] / length) : 0.0f;
+        order[c] = (uint32_t)c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+    for (uint32_t c : order)
+    {
+        const size_t end = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+        output.insert(output.end(), indices + clusters[c] * 3, indices + end * 3);
+    }
+    std::memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+// Vertexleri indekslerdeki ilk kullanım sırasına dizer ve indeksleri yeniden
+// numaralar. Kullanılmayan vertexler atılır; kalan vertex sayısını döndürür.
+inline size_t optimizeVertexFetch(float *vertices, size_t vertexCount, uint32_t *indices, size_t indexCount)
+{
+    std::vector<uint32_t> newIndex(vertexCount, UINT32_MAX);
+    std::vector<float> reordered;
+    reordered.reserve(vertexCount * 9);
+    for (size_t i = 0; i < indexCount; ++i)
+    {
+        uint32_t &index = newIndex[indices[i]];
+        if (index == UINT32_MAX)
+        {
+            index = (uint32_t)(reordered.size() / 9);
+            reordered.insert(reordered.end(), vertices + indices[i] * 9, vertices + indices[i] * 9 + 9);
+        }
+        indices[i] = index;
+    }
+    std::memcpy(vertices, reordered.data(), reordered.size() * sizeof(float));
+    return reordered.size() / 9;
+}
+
+// Aşama aşama önbellek simülasyonu (FIFO): girdi, önbellek sıralaması ve
+// overdraw sıralaması sonrası. Overdraw aşaması ACMR'yi en fazla eşiği kadar
+// kötüleştirebilir; önbelleğe zaten sığan küçük meshlerde bu görünür.
+struct MeshOptimizeStats
+{
+    VertexCacheStats input;
+    VertexCacheStats vertexCache;
+    VertexCacheStats overdraw;
+
+    void print(std::ostream &out) const
+    {
+        if (input.triangles == 0)
+            return;
+        out << "Vertex önbelleği (FIFO " << SIMULATED_CACHE_SIZE << "): ACMR " << input.acmr() << " -> "
+            << vertexCache.acmr() << " -> " << overdraw.acmr() << " (overdraw), ATVR " << input.atvr() << " -> "
+            << vertexCache.atvr() << " -> " << overdraw.atvr() << std::endl;
+    }
+};
+
+// Üç aşama sırayla; stats verilirse her aşamanın simülasyonu toplanır.
+// Kalan (kullanılan) vertex sayısını döndürür.
+inline size_t optimizeMesh(float *vertices, size_t vertexCount, uint32_t *indices, size_t indexCount,
+                           MeshOptimizeStats *stats = nullptr)
+{
+    if (stats)
+        stats->input += analyzeVertexCache(indices, indexCount, vertexCount);
+    optimizeVertexCache(indices, indexCount, vertexCount);
+    if (stats)
+        stats->vertexCache += analyzeVertexCache(indices, indexCount, vertexCount);
+    optimizeOverdraw(indices, indexCount, vertices, vertexCount);
+    vertexCount = optimizeVertexFetch(vertices, vertexCount, indices, indexCount);
+    if (stats)
+        stats->overdraw += analyzeVertexCache(indices, indexCount, vertexCount);
+    return vertexCount;
+}
+
+#endif
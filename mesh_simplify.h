@@ -0,0 +1,558 @@
+#ifndef MESH_SIMPLIFY_H
+#define MESH_SIMPLIFY_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "lod.h"
+#include "mesh_weld.h"
+#include "parallel.h"
+
+// Quadric error metric (Garland & Heckbert) ile mesh sadeleştirme. Kenarlar
+// yarım kenar olarak çöktürülür (u, v'nin mevcut konumuna taşınır); böylece
+// hiçbir vertexin normali ya da rengi yeniden hesaplanmaz, sadece indeksler
+// değişir. Aynı konumdaki farklı vertexler (farklı normal / renk: kutunun
+// kenarları, renk sınırları) öznitelik dikişidir; dikiş vertexleri sadece
+// dikiş boyunca, açık kenardaki vertexler sadece kenar boyunca kayar, ikiden
+// fazla kopyası olan köşeler hiç hareket etmez.
+//
+// Sonuç deterministiktir: aynı girdi her zaman aynı çıktıyı verir (bütün
+// sıralamalar eşitlikte indekse göre bozulur, hash tabloları sadece arama için).
+
+// Simetrik 4x4 quadric: alanla ağırlıklandırılmış düzlem uzaklıklarının karesi
+struct Quadric
+{
+    double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0;
+    double weight = 0;
+
+    // ax + by + cz + d = 0 düzlemi (normal birim uzunlukta)
+    void addPlane(const glm::dvec3 &n, double d, double w)
+    {
+        a2 += w * n.x * n.x, ab += w * n.x * n.y, ac += w * n.x * n.z, ad += w * n.x * d;
+        b2 += w * n.y * n.y, bc += w * n.y * n.z, bd += w * n.y * d;
+        c2 += w * n.z * n.z, cd += w * n.z * d;
+        d2 += w * d * d;
+        weight += w;
+    }
+
+    Quadric &operator+=(const Quadric &q)
+    {
+        a2 += q.a2, ab += q.ab, ac += q.ac, ad += q.ad, b2 += q.b2, bc += q.bc, bd += q.bd;
+        c2 += q.c2, cd += q.cd, d2 += q.d2, weight += q.weight;
+        return *this;
+    }
+
+    double evaluate(const glm::dvec3 &p) const
+    {
+        const double e = a2 * p.x * p.x + 2 * ab * p.x * p.y + 2 * ac * p.x * p.z + 2 * ad * p.x +
+                         b2 * p.y * p.y + 2 * bc * p.y * p.z + 2 * bd * p.y +
+                         c2 * p.z * p.z + 2 * cd * p.z + d2;
+        return e > 0 ? e : 0;
+    }
+};
+
+// Açık kenar ve dikişlerin şeklini koruyan dik düzlemlerin ağırlığı
+const double SIMPLIFY_EDGE_WEIGHT = 10.0;
+const int SIMPLIFY_MAX_PASSES = 64;
+
+namespace simplify_detail
+{
+    enum VertexKind
+    {
+        KIND_INTERIOR, // Tek kopya, kapalı çevre
+        KIND_BORDER,   // Tek kopya, açık kenar üzerinde (tam iki açık kenar)
+        KIND_SEAM,     // İki kopya, tam iki dikiş kenarı
+        KIND_LOCKED,   // Diğer her şey (köşeler, manifold olmayan kenarlar)
+    };
+
+    enum EdgeKind
+    {
+        EDGE_MANIFOLD,
+        EDGE_BORDER,
+        EDGE_SEAM,
+        EDGE_COMPLEX,
+    };
+
+    // Üçgen kenarı: konum kimlikleri (pa -> pb) ve vertex indeksleri (va -> vb)
+    struct HalfEdge
+    {
+        uint32_t pa, pb, va, vb;
+    };
+
+    struct Edge
+    {
+        uint32_t first; // halfEdges içindeki ilk yarım kenar
+        uint32_t count;
+        EdgeKind kind;
+    };
+
+    struct Candidate
+    {
+        double cost;
+        uint32_t edge;
+        uint32_t from, to; // Konum kimlikleri
+    };
+
+    inline uint32_t resolve(const std::vector<uint32_t> &remap, uint32_t v)
+    {
+        while (remap[v] != v)
+            v = remap[v];
+        return v;
+    }
+
+    struct Simplifier
+    {
+        const std::vector<float> &vertices;
+        std::vector<uint32_t> triangles;
+        std::vector<uint32_t> positionOf;  // vertex -> konum kimliği
+        std::vector<glm::dvec3> positions; // konum kimliği -> konum
+        std::vector<Quadric> quadrics;     // konum kimliği başına
+        std::vector<uint32_t> remap;       // vertex -> çöktüğü vertex
+        std::vector<HalfEdge> halfEdges;
+        std::vector<Edge> edges;
+        std::vector<VertexKind> kinds;
+        std::vector<uint32_t> triangleOffsets, triangleList; // konum -> üçgenler (CSR)
+        double maxError = 0.0;
+
+        Simplifier(const WeldedMesh &mesh) : vertices(mesh.vertices), triangles(mesh.indices)
+        {
+            const size_t vertexCount = vertices.size() / 9;
+            positionOf.resize(vertexCount);
+            remap.resize(vertexCount);
+
+            // Aynı konumdaki vertexler tek konum kimliği alır (ilk görülme sırasıyla)
+            std::unordered_map<WeldKey, uint32_t, WeldKeyHash> lookup;
+            for (size_t v = 0; v < vertexCount; ++v)
+            {
+                WeldKey key = {};
+                for (int k = 0; k < 3; ++k)
+                {
+                    float f = vertices[v * 9 + k] + 0.0f;
+                    std::memcpy(&key.bits[k], &f, sizeof(float));
+                }
+                auto it = lookup.emplace(key, (uint32_t)positions.size());
+                if (it.second)
+                    positions.push_back(glm::dvec3(vertices[v * 9], vertices[v * 9 + 1], vertices[v * 9 + 2]));
+                positionOf[v] = it.first->second;
+                remap[v] = (uint32_t)v;
+            }
+            quadrics.resize(positions.size());
+            removeDegenerate();
+        }
+
+        // Konumu çakışan köşesi olan üçgenleri atar (çöken kenarların üçgenleri)
+        void removeDegenerate()
+        {
+            size_t out = 0;
+            for (size_t t = 0; t + 2 < triangles.size(); t += 3)
+            {
+                const uint32_t a = resolve(remap, triangles[t]), b = resolve(remap, triangles[t + 1]),
+                               c = resolve(remap, triangles[t + 2]);
+                if (positionOf[a] == positionOf[b] || positionOf[b] == positionOf[c] || positionOf[c] == positionOf[a])
+                    continue;
+                triangles[out++] = a, triangles[out++] = b, triangles[out++] = c;
+            }
+            triangles.resize(out);
+        }
+
+        // Kenarları ve vertex türlerini mevcut üçgenlerden yeniden çıkarır
+        void analyze()
+        {
+            const size_t positionCount = positions.size();
+            halfEdges.clear();
+            halfEdges.reserve(triangles.size());
+            for (size_t t = 0; t < triangles.size(); t += 3)
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32_t va = triangles[t + k], vb = triangles[t + (k + 1) % 3];
+                    halfEdges.push_back({positionOf[va], positionOf[vb], va, vb});
+                }
+            std::sort(halfEdges.begin(), halfEdges.end(), [](const HalfEdge &x, const HalfEdge &y)
+                      {
+                          const uint32_t x0 = std::min(x.pa, x.pb), x1 = std::max(x.pa, x.pb);
+                          const uint32_t y0 = std::min(y.pa, y.pb), y1 = std::max(y.pa, y.pb);
+                          if (x0 != y0)
+                              return x0 < y0;
+                          if (x1 != y1)
+                              return x1 < y1;
+                          if (x.pa != y.pa)
+                              return x.pa < y.pa;
+                          return x.va != y.va ? x.va < y.va : x.vb < y.vb; });
+
+            std::vector<uint32_t> borderCount(positionCount, 0), seamCount(positionCount, 0), copies(positionCount, 0);
+            std::vector<bool> complex(positionCount, false);
+
+            edges.clear();
+            for (uint32_t i = 0; i < halfEdges.size();)
+            {
+                const HalfEdge &h = halfEdges[i];
+                uint32_t j = i + 1;
+                while (j < halfEdges.size() && std::min(halfEdges[j].pa, halfEdges[j].pb) == std::min(h.pa, h.pb) &&
+                       std::max(halfEdges[j].pa, halfEdges[j].pb) == std::max(h.pa, h.pb))
+                    ++j;
+
+                Edge edge = {i, j - i, EDGE_COMPLEX};
+                if (edge.count == 1)
+                    edge.kind = EDGE_BORDER;
+                else if (edge.count == 2 && halfEdges[i].pa != halfEdges[i + 1].pa)
+                {
+                    const HalfEdge &g = halfEdges[i + 1];
+                    edge.kind = (h.va == g.vb && h.vb == g.va) ? EDGE_MANIFOLD : EDGE_SEAM;
+                }
+
+                if (edge.kind == EDGE_BORDER)
+                    ++borderCount[h.pa], ++borderCount[h.pb];
+                else if (edge.kind == EDGE_SEAM)
+                    ++seamCount[h.pa], ++seamCount[h.pb];
+                else if (edge.kind == EDGE_COMPLEX)
+                    complex[h.pa] = complex[h.pb] = true;
+                edges.push_back(edge);
+                i = j;
+            }
+
+            // Her konumun kullanılan kopya sayısı
+            std::vector<bool> used(vertices.size() / 9, false);
+            for (uint32_t v : triangles)
+                if (!used[v])
+                    used[v] = true, ++copies[positionOf[v]];
+
+            kinds.assign(positionCount, KIND_LOCKED);
+            for (size_t p = 0; p < positionCount; ++p)
+            {
+                if (complex[p])
+                    continue;
+                if (copies[p] == 1 && borderCount[p] == 0)
+                    kinds[p] = KIND_INTERIOR;
+                else if (copies[p] == 1 && borderCount[p] == 2)
+                    kinds[p] = KIND_BORDER;
+                else if (copies[p] == 2 && borderCount[p] == 0 && seamCount[p] == 2)
+                    kinds[p] = KIND_SEAM;
+            }
+
+            // Konum -> üçgen listesi
+            triangleOffsets.assign(positionCount + 1, 0);
+            for (uint32_t v : triangles)
+                ++triangleOffsets[positionOf[v] + 1];
+            for (size_t p = 0; p < positionCount; ++p)
+                triangleOffsets[p + 1] += triangleOffsets[p];
+            triangleList.resize(triangles.size());
+            std::vector<uint32_t> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+            for (size_t i = 0; i < triangles.size(); ++i)
+                triangleList[fill[positionOf[triangles[i]]]++] = (uint32_t)(i / 3);
+        }
+
+        // Yüzey düzlemleri ve (ilk geçişte) açık kenar / dikiş düzlemleri
+        void computeQuadrics()
+        {
+            for (size_t t = 0; t < triangles.size(); t += 3)
+            {
+                const glm::dvec3 &p0 = positions[positionOf[triangles[t]]];
+                const glm::dvec3 &p1 = positions[positionOf[triangles[t + 1]]];
+                const glm::dvec3 &p2 = positions[positionOf[triangles[t + 2]]];
+                glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+                const double length = glm::length(n);
+                if (length <= 0.0)
+                    continue;
+                n /= length;
+                Quadric q;
+                q.addPlane(n, -glm::dot(n, p0), length * 0.5);
+                for (int k = 0; k < 3; ++k)
+                    quadrics[positionOf[triangles[t + k]]] += q;
+            }
+
+            for (const Edge &edge : edges)
+            {
+                if (edge.kind != EDGE_BORDER && edge.kind != EDGE_SEAM)
+                    continue;
+                for (uint32_t i = edge.first; i < edge.first + edge.count; ++i)
+                {
+                    const HalfEdge &h = halfEdges[i];
+                    const glm::dvec3 &a = positions[h.pa], &b = positions[h.pb];
+                    const glm::dvec3 faceNormal = this->faceNormal(h);
+                    glm::dvec3 n = glm::cross(b - a, faceNormal);
+                    const double length = glm::length(n);
+                    if (length <= 0.0)
+                        continue;
+                    n /= length;
+                    Quadric q;
+                    q.addPlane(n, -glm::dot(n, a), glm::length(b - a) * glm::length(b - a) * SIMPLIFY_EDGE_WEIGHT);
+                    quadrics[h.pa] += q;
+                    quadrics[h.pb] += q;
+                }
+            }
+        }
+
+        // Yarım kenarın ait olduğu üçgenin birim normali
+        glm::dvec3 faceNormal(const HalfEdge &h) const
+        {
+            for (uint32_t i = triangleOffsets[h.pa]; i < triangleOffsets[h.pa + 1]; ++i)
+            {
+                const uint32_t t = triangleList[i] * 3;
+                for (int k = 0; k < 3; ++k)
+                    if (triangles[t + k] == h.va && triangles[t + (k + 1) % 3] == h.vb)
+                    {
+                        const glm::dvec3 n = glm::cross(positions[h.pb] - positions[h.pa],
+                                                        positions[positionOf[triangles[t + (k + 2) % 3]]] - positions[h.pa]);
+                        const double length = glm::length(n);
+                        return length > 0.0 ? n / length : glm::dvec3(0.0);
+                    }
+            }
+            return glm::dvec3(0.0);
+        }
+
+        // from -> to çöküşü için from'un kopyalarının eşleneceği to kopyaları.
+        // İzin verilmeyen çöküşte false döner.
+        bool collapseTargets(const Edge &edge, uint32_t from, uint32_t to, uint32_t (&source)[2], uint32_t (&target)[2], int &pairs) const
+        {
+            const VertexKind kind = kinds[from];
+            const HalfEdge &h = halfEdges[edge.first];
+            auto vertexAt = [&](const HalfEdge &e, uint32_t p) { return e.pa == p ? e.va : e.vb; };
+
+            if (kind == KIND_INTERIOR)
+            {
+                if (edge.kind != EDGE_MANIFOLD && edge.kind != EDGE_SEAM)
+                    return false;
+                const HalfEdge &g = halfEdges[edge.first + 1];
+                if (vertexAt(h, to) != vertexAt(g, to))
+                    return false;
+                source[0] = vertexAt(h, from), target[0] = vertexAt(h, to), pairs = 1;
+                return true;
+            }
+            if (kind == KIND_BORDER)
+            {
+                if (edge.kind != EDGE_BORDER || (kinds[to] != KIND_BORDER && kinds[to] != KIND_LOCKED))
+                    return false;
+                source[0] = vertexAt(h, from), target[0] = vertexAt(h, to), pairs = 1;
+                return true;
+            }
+            if (kind == KIND_SEAM)
+            {
+                if (edge.kind != EDGE_SEAM || (kinds[to] != KIND_SEAM && kinds[to] != KIND_LOCKED))
+                    return false;
+                const HalfEdge &g = halfEdges[edge.first + 1];
+                source[0] = vertexAt(h, from), target[0] = vertexAt(h, to);
+                source[1] = vertexAt(g, from), target[1] = vertexAt(g, to);
+                if (source[0] == source[1] || target[0] == target[1])
+                    return false;
+                pairs = 2;
+                return true;
+            }
+            return false;
+        }
+
+        // from konumu to'ya taşınınca (kopyaları source[i] -> target[i])
+        // komşu üçgenlerden biri ters dönüyor mu
+        bool flips(uint32_t from, uint32_t to, const uint32_t *source, const uint32_t *target, int pairs) const
+        {
+            for (uint32_t i = triangleOffsets[from]; i < triangleOffsets[from + 1]; ++i)
+            {
+                const uint32_t t = triangleList[i] * 3;
+                uint32_t p[3];
+                for (int k = 0; k < 3; ++k)
+                    p[k] = positionOf[resolve(remap, triangles[t + k])];
+                if (p[0] == p[1] || p[1] == p[2] || p[2] == p[0] || p[0] == to || p[1] == to || p[2] == to)
+                    continue; // Çökecek ya da zaten çökmüş üçgen
+
+                glm::dvec3 before[3], after[3], shading(0.0);
+                for (int k = 0; k < 3; ++k)
+                {
+                    before[k] = positions[p[k]];
+                    after[k] = p[k] == from ? positions[to] : before[k];
+                    uint32_t v = resolve(remap, triangles[t + k]);
+                    for (int i = 0; i < pairs; ++i)
+                        v = v == source[i] ? target[i] : v;
+                    const float *normal = &vertices[v * 9 + 3];
+                    shading += glm::dvec3(normal[0], normal[1], normal[2]);
+                }
+                // Ters dönen ya da vertex normallerine dik hale gelen (birkaç çöküş
+                // boyunca adım adım dönebilir) üçgen kabul edilmez
+                const glm::dvec3 n0 = glm::cross(before[1] - before[0], before[2] - before[0]);
+                const glm::dvec3 n1 = glm::cross(after[1] - after[0], after[2] - after[0]);
+                if (glm::dot(n0, n1) <= 1e-2 * glm::length(n0) * glm::length(n1) ||
+                    glm::dot(n1, shading) <= 1e-2 * glm::length(n1) * glm::length(shading))
+                    return true;
+            }
+            return false;
+        }
+
+        double cost(uint32_t from, uint32_t to) const
+        {
+            Quadric q = quadrics[from];
+            q += quadrics[to];
+            return q.weight > 0.0 ? q.evaluate(positions[to]) / q.weight : 0.0;
+        }
+
+        // Bir geçiş: bütün aday çöküşler maliyete göre sıralanır, birbirine
+        // dokunmayanlar sırayla uygulanır. Silinen üçgen sayısını döndürür.
+        size_t pass(size_t targetTriangles)
+        {
+            std::vector<Candidate> candidates;
+            candidates.reserve(edges.size());
+            for (uint32_t e = 0; e < edges.size(); ++e)
+            {
+                const HalfEdge &h = halfEdges[edges[e].first];
+                uint32_t source[2], target[2];
+                int pairs = 0;
+                Candidate best = {0.0, e, UINT32_MAX, UINT32_MAX};
+                const uint32_t ends[2][2] = {{h.pa, h.pb}, {h.pb, h.pa}};
+                for (const auto &end : ends)
+                {
+                    if (!collapseTargets(edges[e], end[0], end[1], source, target, pairs))
+                        continue;
+                    const double c = cost(end[0], end[1]);
+                    if (best.from == UINT32_MAX || c < best.cost)
+                        best = {c, e, end[0], end[1]};
+                }
+                if (best.from != UINT32_MAX)
+                    candidates.push_back(best);
+            }
+            std::sort(candidates.begin(), candidates.end(), [](const Candidate &x, const Candidate &y)
+                      { return x.cost != y.cost ? x.cost < y.cost : x.edge < y.edge; });
+
+            const size_t triangleCount = triangles.size() / 3;
+            std::vector<bool> touched(positions.size(), false);
+            size_t removed = 0;
+            for (const Candidate &candidate : candidates)
+            {
+                if (triangleCount - removed <= targetTriangles)
+                    break;
+                if (touched[candidate.from] || touched[candidate.to])
+                    continue;
+                uint32_t source[2], target[2];
+                int pairs = 0;
+                collapseTargets(edges[candidate.edge], candidate.from, candidate.to, source, target, pairs);
+                if (flips(candidate.from, candidate.to, source, target, pairs))
+                    continue;
+
+                for (int i = 0; i < pairs; ++i)
+                    remap[source[i]] = target[i];
+                quadrics[candidate.to] += quadrics[candidate.from];
+                maxError = std::max(maxError, candidate.cost);
+                touched[candidate.from] = touched[candidate.to] = true;
+                removed += edges[candidate.edge].count;
+            }
+            return removed;
+        }
+
+        void run(size_t targetTriangles)
+        {
+            for (int i = 0; i < SIMPLIFY_MAX_PASSES && triangles.size() / 3 > targetTriangles; ++i)
+            {
+                analyze();
+                if (i == 0)
+                    computeQuadrics();
+                if (pass(targetTriangles) == 0)
+                    break;
+                removeDegenerate();
+            }
+        }
+
+        // Kullanılan vertexleri ilk kullanım sırasıyla yeni bir meshe toplar
+        WeldedMesh compact() const
+        {
+            WeldedMesh mesh;
+            std::vector<uint32_t> newIndex(vertices.size() / 9, UINT32_MAX);
+            mesh.indices.reserve(triangles.size());
+            for (uint32_t v : triangles)
+            {
+                if (newIndex[v] == UINT32_MAX)
+                {
+                    newIndex[v] = (uint32_t)(mesh.vertices.size() / 9);
+                    mesh.vertices.insert(mesh.vertices.end(), vertices.begin() + v * 9, vertices.begin() + v * 9 + 9);
+                }
+                mesh.indices.push_back(newIndex[v]);
+            }
+            mesh.removedVertices = vertices.size() / 9 - mesh.vertices.size() / 9;
+            return mesh;
+        }
+    };
+}
+
+// mesh'i en fazla targetTriangles üçgene indirmeye çalışır (dikişler ve açık
+// kenarlar izin vermezse daha fazla kalabilir). error, yüzeyden tahmini en
+// büyük sapmayı (model uzayı birimi) alır; LodChain seviye hatası olarak
+// kullanılabilir.
+inline WeldedMesh simplifyMesh(const WeldedMesh &mesh, size_t targetTriangles, float *error = nullptr)
+{
+    simplify_detail::Simplifier simplifier(mesh);
+    simplifier.run(targetTriangles);
+    if (error)
+        *error = (float)std::sqrt(simplifier.maxError);
+    return simplifier.compact();
+}
+
+// Bir LOD seviyesi: sadeleştirilmiş mesh ve hatası
+struct MeshLod
+{
+    WeldedMesh mesh;
+    float error = 0.0f;
+};
+
+// Varsayılan hedef üçgen oranları (ilk seviye orijinal mesh)
+const float DEFAULT_LOD_RATIOS[] = {1.0f, 0.5f, 0.25f, 0.125f};
+
+// Her oran için orijinal meshten ayrı ayrı sadeleştirilir (hatalar birikmez)
+inline MeshLod simplifyLod(const WeldedMesh &mesh, float ratio)
+{
+    MeshLod lod;
+    const size_t triangleCount = mesh.indices.size() / 3;
+    if (ratio >= 1.0f)
+        lod.mesh = mesh;
+    else
+        lod.mesh = simplifyMesh(mesh, (size_t)(triangleCount * ratio), &lod.error);
+    return lod;
+}
+
+// Bütün meshlerin LOD zincirlerini üretir: her (mesh, oran) çifti ayrı bir
+// görevdir ve iş parçacıklarına dağıtılır. Görevler birbirinden bağımsız
+// olduğundan sonuç iş parçacığı sayısından bağımsızdır. maxWorkers 0 ise
+// parallelFor'daki gibi donanımın iş parçacığı sayısı kullanılır.
+inline std::vector<std::vector<MeshLod>> buildLodChains(const std::vector<WeldedMesh> &meshes, const float *ratios, size_t ratioCount,
+                                                        unsigned maxWorkers = 0)
+{
+    std::vector<std::vector<MeshLod>> chains(meshes.size(), std::vector<MeshLod>(ratioCount));
+    parallelFor(meshes.size() * ratioCount, [&](size_t task)
+                {
+                    const size_t mesh = task / ratioCount, level = task % ratioCount;
+                    chains[mesh][level] = simplifyLod(meshes[mesh], ratios[level]); },
+                maxWorkers);
+    return chains;
+}
+
+// Sadeleştirilmiş seviyelerden LodChain kurar; add(mesh) seviyeyi çizilebilir
+// hale getirir (MeshArena::addIndexed gibi) ve Level'ı döndürür. Aynı
+// üçgen sayısına inen (daha fazla sadeleşemeyen) seviyeler atlanır.
+template <class Level, class AddFn>
+LodChain<Level> makeLodChain(const std::vector<MeshLod> &lods, AddFn add)
+{
+    glm::vec3 boundsMin(0.0f), boundsMax(0.0f);
+    if (!lods.empty() && !lods[0].mesh.vertices.empty())
+    {
+        const std::vector<float> &v = lods[0].mesh.vertices;
+        boundsMin = boundsMax = glm::vec3(v[0], v[1], v[2]);
+        for (size_t i = 9; i + 2 < v.size(); i += 9)
+        {
+            boundsMin = glm::min(boundsMin, glm::vec3(v[i], v[i + 1], v[i + 2]));
+            boundsMax = glm::max(boundsMax, glm::vec3(v[i], v[i + 1], v[i + 2]));
+        }
+    }
+
+    LodChain<Level> chain(boundsMin, boundsMax);
+    size_t previousTriangles = SIZE_MAX;
+    for (const MeshLod &lod : lods)
+    {
+        const size_t triangles = lod.mesh.indices.size() / 3;
+        if (triangles == 0 || triangles >= previousTriangles)
+            continue;
+        chain.addLevel(add(lod.mesh), lod.error);
+        previousTriangles = triangles;
+    }
+    return chain;
+}
+
+#endif
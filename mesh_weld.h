@@ -0,0 +1,120 @@
+#ifndef MESH_WELD_H
+#define MESH_WELD_H
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+// Kaynaklanmış (indeksli) mesh: tekrarsız vertexler + üçgen indeksleri
+struct WeldedMesh
+{
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    size_t removedVertices = 0;
+};
+
+// Bir vertexin (pozisyon, normal, renk) bit deseni; hash anahtarı olarak kullanılır
+struct WeldKey
+{
+    uint32_t bits[9];
+
+    bool operator==(const WeldKey &other) const
+    {
+        return std::memcmp(bits, other.bits, sizeof(bits)) == 0;
+    }
+};
+
+struct WeldKeyHash
+{
+    size_t operator()(const WeldKey &key) const
+    {
+        // FNV-1a
+        uint64_t h = 1469598103934665603ull;
+        for (uint32_t b : key.bits)
+        {
+            h ^= b;
+            h *= 1099511628211ull;
+        }
+        return (size_t)h;
+    }
+};
+
+// Aynı (pozisyon, normal, renk) üçlüsüne sahip vertexleri birleştirir.
+// Girdi GL_TRIANGLES düzeninde 9 float'lık vertexlerdir; çıktı sıkıştırılmış
+// vertex dizisi ve her girdi vertexi için bir indekstir.
+inline WeldedMesh weldVertices(const float *data, size_t vertexCount)
+{
+    const int stride = 9;
+
+    WeldedMesh mesh;
+    mesh.indices.reserve(vertexCount);
+
+    std::unordered_map<WeldKey, uint32_t, WeldKeyHash> lookup;
+    lookup.reserve(vertexCount);
+
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        const float *v = data + i * stride;
+
+        WeldKey key;
+        for (int k = 0; k < stride; ++k)
+        {
+            float f = v[k] + 0.0f; // -0.0 ile 0.0 aynı vertex sayılsın
+            std::memcpy(&key.bits[k], &f, sizeof(float));
+        }
+
+        auto it = lookup.find(key);
+        if (it == lookup.end())
+        {
+            uint32_t index = (uint32_t)(mesh.vertices.size() / stride);
+            lookup.emplace(key, index);
+            mesh.vertices.insert(mesh.vertices.end(), v, v + stride);
+            mesh.indices.push_back(index);
+        }
+        else
+        {
+            mesh.indices.push_back(it->second);
+        }
+    }
+
+    mesh.removedVertices = vertexCount - mesh.vertices.size() / stride;
+    return mesh;
+}
+
+// GL_TRIANGLE_FAN / GL_TRIANGLE_STRIP düzenindeki 9 float'lık vertexleri
+// GL_TRIANGLES listesine açar (indirect ve Vulkan yolları sadece üçgen listesi çizer)
+inline std::vector<float> toTriangleList(const float *data, size_t vertexCount, GLenum mode)
+{
+    std::vector<float> triangles;
+    auto pushVertex = [&](size_t i)
+    {
+        triangles.insert(triangles.end(), data + i * 9, data + i * 9 + 9);
+    };
+
+    if (mode == GL_TRIANGLE_FAN)
+    {
+        for (size_t i = 1; i + 1 < vertexCount; ++i)
+        {
+            pushVertex(0);
+            pushVertex(i);
+            pushVertex(i + 1);
+        }
+    }
+    else if (mode == GL_TRIANGLE_STRIP)
+    {
+        // Tek üçgenlerde sarma yönü korunsun diye ilk iki vertex yer değiştirir
+        for (size_t i = 0; i + 2 < vertexCount; ++i)
+        {
+            pushVertex(i % 2 ? i + 1 : i);
+            pushVertex(i % 2 ? i : i + 1);
+            pushVertex(i + 2);
+        }
+    }
+    else
+        triangles.assign(data, data + vertexCount * 9);
+    return triangles;
+}
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef MESHLET_H
+#define MESHLET_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "frustum.h"
+
+// Meshlet (küme): indeksli meshin en fazla 64 vertex / 124 üçgenlik, uzayda
+// bitişik ve aşağı yukarı aynı yöne bakan parçası. Her küme sınır küresini ve
+// normal konisini saklar; CPU her karede çizim listesini kurmadan önce
+// görüş hacminin dışında kalan ya da bütün üçgenleri kameraya arkasını dönen
+// kümeleri atar. Kapalı bir kutunun yüzleri ayrı kümelere düştüğü için içeriden
+// bakılan odada her kutunun yaklaşık yarısı hiç gönderilmez.
+const size_t MESHLET_MAX_VERTICES = 64;
+const size_t MESHLET_MAX_TRIANGLES = 124;
+const float MESHLET_CONE_COS = 0.7f; // Kümeye eklenen üçgenin normali ile küme ekseni arasındaki en büyük açının kosinüsü (~45°)
+const float MESHLET_MIN_CONE_DOT = 0.1f; // Koninin yarı açısı bundan genişse (~84°) koni testi yapılmaz
+
+// Model uzayında küme sınırları
+struct MeshletBounds
+{
+    glm::vec3 center = glm::vec3(0.0f); // Sınır küresi
+    float radius = 0.0f;
+    glm::vec3 coneApex = glm::vec3(0.0f); // Normal konisi: bütün üçgen düzlemleri tepe noktasının önünde
+    glm::vec3 coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+    float coneCutoff = 1.0f; // Yarı açının sinüsü; 1 = koni kullanılamaz
+};
+
+// Bir küme: indeks dizisinde ardışık üçgenler
+struct Meshlet
+{
+    uint32_t firstIndex = 0;
+    uint32_t triangleCount = 0;
+    uint32_t vertexCount = 0;
+    MeshletBounds bounds;
+};
+
+namespace meshlet_detail
+{
+    inline glm::vec3 position(const float *vertices, uint32_t index)
+    {
+        const float *v = vertices + (size_t)index * 9;
+        return glm::vec3(v[0], v[1], v[2]);
+    }
+
+    // Birim üçgen normali; dejenere üçgende 0. Sahnenin sarım yönü tutarlı
+    // değil (yüz ayıklama kapalı), bu yüzden ön yüz sarımdan değil vertex
+    // normallerinden belirlenir: düzlem normali onlarla aynı yöne çevrilir.
+    // Vertex normalleri düzleme neredeyse paralelse (ör. monitör tabanı) yön
+    // belirsizdir; bu üçgeni içeren küme koni testine girmez.
+    inline glm::vec3 triangleNormal(const float *vertices, const uint32_t *triangle, bool *ambiguous = nullptr)
+    {
+        const glm::vec3 a = position(vertices, triangle[0]);
+        glm::vec3 normal = glm::cross(position(vertices, triangle[1]) - a, position(vertices, triangle[2]) - a);
+        const float length = glm::length(normal);
+        if (length <= 0.0f)
+            return glm::vec3(0.0f);
+
+        glm::vec3 shading(0.0f);
+        for (int k = 0; k < 3; ++k)
+        {
+            const float *v = vertices + (size_t)triangle[k] * 9;
+            shading += glm::vec3(v[3], v[4], v[5]);
+        }
+        normal /= length;
+        const float facing = glm::dot(normal, shading);
+        if (ambiguous && std::abs(facing) < MESHLET_MIN_CONE_DOT * glm::length(shading))
+            *ambiguous = true;
+        return facing < 0.0f ? -normal : normal;
+    }
+}
+
+// indices[0 .. indexCount) üçgenlerinin sınır küresi ve normal konisi
+inline MeshletBounds computeMeshletBounds(const float *vertices, const uint32_t *indices, size_t indexCount)
+{
+    using namespace meshlet_detail;
+    MeshletBounds bounds;
+    if (indexCount < 3)
+        return bounds;
+
+    // Küre: sınır kutusunun merkezi ve en uzak vertex
+    glm::vec3 boundsMin(std::numeric_limits<float>::max()), boundsMax(-std::numeric_limits<float>::max());
+    for (size_t i = 0; i < indexCount; ++i)
+    {
+        const glm::vec3 p = position(vertices, indices[i]);
+        boundsMin = glm::min(boundsMin, p);
+        boundsMax = glm::max(boundsMax, p);
+    }
+    bounds.center = (boundsMin + boundsMax) * 0.5f;
+    for (size_t i = 0; i < indexCount; ++i)
+        bounds.radius = std::max(bounds.radius, glm::length(position(vertices, indices[i]) - bounds.center));
+
+    // Koni ekseni: üçgen normallerinin ortalaması; yarı açı en sapan normalden
+    glm::vec3 axis(0.0f);
+    for (size_t i = 0; i + 2 < indexCount; i += 3)
+        axis += triangleNormal(vertices, indices + i);
+    const float axisLength = glm::length(axis);
+    if (axisLength <= 0.0f)
+        return bounds;
+    axis /= axisLength;
+
+    float minDot = 1.0f;
+    bool ambiguous = false;
+    for (size_t i = 0; i + 2 < indexCount; i += 3)
+    {
+        const glm::vec3 normal = triangleNormal(vertices, indices + i, &ambiguous);
+        if (normal != glm::vec3(0.0f))
+            minDot = std::min(minDot, glm::dot(normal, axis));
+    }
+    bounds.coneAxis = axis;
+    bounds.coneApex = bounds.center;
+    if (ambiguous || minDot <= MESHLET_MIN_CONE_DOT)
+        return bounds;
+
+    // Tepe noktası eksen boyunca, bütün üçgen düzlemlerinin arkasında kalacak
+    // kadar geriye çekilir; düz bir yüzde tepe merkezin kendisidir
+    float apexDistance = 0.0f;
+    for (size_t i = 0; i + 2 < indexCount; i += 3)
+    {
+        const glm::vec3 normal = triangleNormal(vertices, indices + i);
+        const float alignment = glm::dot(normal, axis);
+        if (alignment > 0.0f)
+            apexDistance = std::max(apexDistance,
+                                    glm::dot(bounds.center - position(vertices, indices[i]), normal) / alignment);
+    }
+    bounds.coneApex = bounds.center - axis * apexDistance;
+    bounds.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+    return bounds;
+}
+
+// Üçgenleri kümelere ayırır ve indices'i yerinde, her küme ardışık olacak
+// biçimde yeniden dizer. Kümeler açgözlü büyütülür: sıradaki atanmamış üçgen
+// tohum olur, ardından kümenin vertexlerini paylaşan üçgenlerden en az yeni
+// vertex getiren (eşitlikte normali küme eksenine en yakın olan) eklenir.
+// Ekseninden MESHLET_CONE_COS'tan fazla sapan üçgen alınmaz, böylece keskin
+// kenarlarda (kutunun yüzleri) kümeler ayrılır ve koniler dar kalır. Girdinin
+// önbellek sırası (optimizeMesh) tohum sırası olarak korunur.
+inline std::vector<Meshlet> buildMeshlets(const float *vertices, size_t vertexCount, uint32_t *indices, size_t indexCount)
+{
+    using namespace meshlet_detail;
+    const size_t triangleCount = indexCount / 3;
+    std::vector<Meshlet> meshlets;
+    if (triangleCount == 0)
+        return meshlets;
+
+    std::vector<glm::vec3> normals(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t)
+        normals[t] = triangleNormal(vertices, indices + t * 3);
+
+    // Vertex -> üçgen komşuluğu (sıkıştırılmış satırlar)
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+        ++adjacencyOffsets[indices[i] + 1];
+    for (size_t v = 0; v < vertexCount; ++v)
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            adjacency[fill[indices[i]]++] = (uint32_t)(i / 3);
+    }
+
+    const uint32_t none = std::numeric_limits<uint32_t>::max();
+    std::vector<char> emitted(triangleCount, 0);
+    std::vector<uint32_t> vertexMeshlet(vertexCount, none); // Vertexin şu anki kümede olup olmadığı
+    std::vector<uint32_t> meshletVertices, meshletTriangles;
+    std::vector<uint32_t> sorted;
+    sorted.reserve(triangleCount * 3);
+
+    size_t seed = 0;
+    while (true)
+    {
+        while (seed < triangleCount && emitted[seed])
+            ++seed;
+        if (seed == triangleCount)
+            break;
+
+        const uint32_t current = (uint32_t)meshlets.size();
+        meshletVertices.clear();
+        meshletTriangles.clear();
+        glm::vec3 axis(0.0f);
+        auto addTriangle = [&](uint32_t t)
+        {
+            emitted[t] = 1;
+            meshletTriangles.push_back(t);
+            axis += normals[t];
+            for (int k = 0; k < 3; ++k)
+            {
+                const uint32_t v = indices[t * 3 + k];
+                if (vertexMeshlet[v] != current)
+                {
+                    vertexMeshlet[v] = current;
+                    meshletVertices.push_back(v);
+                }
+            }
+        };
+        addTriangle((uint32_t)seed);
+
+        while (meshletTriangles.size() < MESHLET_MAX_TRIANGLES)
+        {
+            const float axisLength = glm::length(axis);
+            const glm::vec3 direction = axisLength > 0.0f ? axis / axisLength : glm::vec3(0.0f);
+
+            uint32_t best = none;
+            int bestNew = 4;
+            float bestDot = -2.0f;
+            for (size_t i = 0; i < meshletVertices.size(); ++i)
+            {
+                const uint32_t v = meshletVertices[i];
+                for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a)
+                {
+                    const uint32_t t = adjacency[a];
+                    if (emitted[t])
+                        continue;
+                    int fresh = 0;
+                    for (int k = 0; k < 3; ++k)
+                        fresh += vertexMeshlet[indices[t * 3 + k]] != current;
+                    if (meshletVertices.size() + fresh > MESHLET_MAX_VERTICES)
+                        continue;
+                    // Dejenere üçgen ya da henüz yönü olmayan küme koniyi bozmaz
+                    const float dot = normals[t] == glm::vec3(0.0f) || axisLength <= 0.0f ? 1.0f : glm::dot(normals[t], direction);
+                    if (dot < MESHLET_CONE_COS)
+                        continue;
+                    if (fresh < bestNew || (fresh == bestNew && dot > bestDot))
+                    {
+                        best = t;
+                        bestNew = fresh;
+                        bestDot = dot;
+                    }
+                }
+            }
+            if (best == none)
+                break;
+            addTriangle(best);
+        }
+
+        Meshlet meshlet;
+        meshlet.firstIndex = (uint32_t)sorted.size();
+        meshlet.triangleCount = (uint32_t)meshletTriangles.size();
+        meshlet.vertexCount = (uint32_t)meshletVertices.size();
+        for (uint32_t t : meshletTriangles)
+            sorted.insert(sorted.end(), indices + t * 3, indices + t * 3 + 3);
+        meshlet.bounds = computeMeshletBounds(vertices, sorted.data() + meshlet.firstIndex, meshlet.triangleCount * 3);
+        meshlets.push_back(meshlet);
+    }
+
+    std::copy(sorted.begin(), sorted.end(), indices);
+    return meshlets;
+}
+
+// Kümenin (model matrisiyle dünyaya taşınmış) çizilmesi gerekip gerekmediği.
+// Model matrisi dönme, öteleme ve eşit ölçekten oluşmalı (koni açısı korunur).
+// Koni testi: kameradan tepe noktasına bakış ekseni ile en fazla
+// (90° - yarı açı) yapıyorsa her üçgen kameraya arkasını döner.
+inline bool meshletVisible(const MeshletBounds &bounds, const glm::mat4 &model, const glm::vec3 &cameraPos,
+                           const Frustum &frustum)
+{
+    const float scale = glm::length(glm::vec3(model[0]));
+    const glm::vec3 center = glm::vec3(model * glm::vec4(bounds.center, 1.0f));
+    if (!sphereInFrustum(frustum, center, bounds.radius * scale))
+        return false;
+
+    if (bounds.coneCutoff >= 1.0f)
+        return true;
+    const glm::vec3 apex = glm::vec3(model * glm::vec4(bounds.coneApex, 1.0f));
+    const glm::vec3 axis = glm::vec3(model * glm::vec4(bounds.coneAxis, 0.0f)) / scale;
+    const glm::vec3 view = apex - cameraPos;
+    return glm::dot(view, axis) < bounds.coneCutoff * glm::length(view);
+}
+
+#endif
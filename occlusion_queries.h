@@ -0,0 +1,282 @@
+#ifndef OCCLUSION_QUERIES_H
+#define OCCLUSION_QUERIES_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gl_state.h"
+#include "shader_program.h"
+
+// Donanım örtme sorguları (GL_ANY_SAMPLES_PASSED + koşullu çizim, ikisi de
+// 3.3 çekirdeğinde), yazılım örtme tamponunun GPU tarafındaki karşılığı.
+// Zamansal tutarlılık: son bilinen sonucu görünür olan nesneler ana geçişte
+// sorgusuz çizilir ve QUERY_RETEST_INTERVAL karede bir (nesneye göre
+// kaydırılarak) vekil kutularıyla yeniden test edilir. Örtülü bilinenlerin
+// vekil kutusu her karede çizilir, nesnenin kendisi de o sorguya bağlı
+// koşullu çizimle gönderilir: kararı GPU verir, görüntü bir kare gecikmeden
+// doğru kalır. Sonuçlar CPU'da hiç beklenmez; bir sonraki karenin başında
+// hazır olanlar okunur, hazır olmayanlar sayılıp sonraki kareye bırakılır;
+// o arada eski sonuç kullanılır. Gerçek bekleme GPU'dadır: koşullu çizim
+// başladığında sorgusu henüz bitmemiş nesneler (gpuWaits) GPU'yu o sonuca
+// kadar durdurabilir.
+const int QUERY_RETEST_INTERVAL = 4;
+// Vekil kutu nesnenin kendi yüzeyleriyle aynı derinlikte kalıp kendi
+// derinliğine takılmasın diye her yönde bu kadar büyütülür
+const float QUERY_PROXY_MARGIN = 0.01f;
+
+// Sorgu sayaçları; hit rate = occluded / results
+struct OcclusionQueryStats
+{
+    size_t issued = 0;      // Çizilen vekil kutu (sorgu)
+    size_t conditional = 0; // Koşullu çizimle gönderilen nesne
+    size_t results = 0;     // Okunan sonuç
+    size_t occluded = 0;    // Sonucu "hiç örnek geçmedi" olan
+    size_t notReady = 0;    // Sorulduğunda hazır olmayan sonuç (beklenmez, sonraki karede tekrar sorulur)
+    // Koşullu çizim başlarken sorgusu henüz hazır olmayan nesne: GL_QUERY_WAIT
+    // ile GPU'nun gerçekten bekleyebileceği yerler (notReady ise CPU tarafında
+    // sorgu gecikmesini gösterir, bekleme değildir)
+    size_t gpuWaits = 0;
+};
+
+class OcclusionQueries
+{
+public:
+    // objectCount nesnenin hepsi başta görünür kabul edilir; yükleme sırasında
+    // (GL durum önbelleği geçersizlenmeden önce) çağrılmalı
+    void create(size_t objectCount)
+    {
+        objects.assign(objectCount, ObjectState());
+
+        program = ShaderProgram(createShaderProgram(proxyVertexSource, proxyFragmentSource));
+        viewProjectionUniform = program.uniform("viewProjection");
+        boundsMinUniform = program.uniform("boundsMin");
+        boundsMaxUniform = program.uniform("boundsMax");
+
+        // Birim küp: 8 köşe, 12 üçgen; yüz yönü önemsiz (yüz ayıklama kapalı)
+        const float corners[] = {0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1};
+        const GLubyte indices[] = {0, 1, 3, 0, 3, 2, 4, 6, 7, 4, 7, 5, 0, 2, 6, 0, 6, 4,
+                                   1, 5, 7, 1, 7, 3, 0, 4, 5, 0, 5, 1, 2, 3, 7, 2, 7, 6};
+        glGenVertexArrays(1, &vertexArray);
+        glGenBuffers(1, &vertexBuffer);
+        glGenBuffers(1, &indexBuffer);
+        glBindVertexArray(vertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
+        glEnableVertexAttribArray(0);
+        glBindVertexArray(0);
+    }
+
+    void destroy()
+    {
+        if (!queryPool.empty())
+            glDeleteQueries((GLsizei)queryPool.size(), queryPool.data());
+        for (const Pending &p : pending)
+            glDeleteQueries(1, &p.query);
+        queryPool.clear();
+        pending.clear();
+        glDeleteVertexArrays(1, &vertexArray);
+        glDeleteBuffers(1, &vertexBuffer);
+        glDeleteBuffers(1, &indexBuffer);
+        vertexArray = vertexBuffer = indexBuffer = 0;
+        program.destroy();
+    }
+
+    // Kare başı: önceki karelerin hazır sonuçları beklemeden okunur (sırayla;
+    // aynı nesnenin yeni sonucu eskisinin üzerine yazar)
+    void collect()
+    {
+        ++frameIndex;
+        frameStats = OcclusionQueryStats();
+        size_t kept = 0;
+        for (const Pending &p : pending)
+        {
+            GLuint available = GL_FALSE;
+            glGetQueryObjectuiv(p.query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            {
+                ++frameStats.notReady;
+                pending[kept++] = p;
+                continue;
+            }
+            GLuint samplesPassed = GL_FALSE;
+            glGetQueryObjectuiv(p.query, GL_QUERY_RESULT, &samplesPassed);
+            ObjectState &object = objects[p.object];
+            object.visible = samplesPassed != GL_FALSE;
+            --object.pendingCount;
+            ++frameStats.results;
+            if (!samplesPassed)
+                ++frameStats.occluded;
+            queryPool.push_back(p.query);
+        }
+        pending.resize(kept);
+        totals.results += frameStats.results;
+        totals.occluded += frameStats.occluded;
+        totals.notReady += frameStats.notReady;
+        for (ObjectState &object : objects)
+            object.query = 0;
+    }
+
+    // Son bilinen sonuç: görünürse ana geçişte sorgusuz çizilir
+    bool visible(size_t object) const
+    {
+        return objects[object].visible;
+    }
+
+    // Görünür nesnenin bu karede yeniden test edilme sırası (önceki testi
+    // hâlâ bekliyorsa yenisi eklenmez)
+    bool retestDue(size_t object) const
+    {
+        return objects[object].pendingCount == 0 && (frameIndex + object) % QUERY_RETEST_INTERVAL == 0;
+    }
+
+    // Vekil kutular: renk ve derinlik yazımı kapalı, derinlik testi açık
+    void beginProxies(const glm::mat4 &viewProjection)
+    {
+        this->viewProjection = viewProjection;
+        program.use();
+        program.set(viewProjectionUniform, viewProjection);
+        glState().bindVertexArray(vertexArray);
+        glState().setColorMask(false);
+        glState().setDepthMask(false);
+    }
+
+    // Dünya uzayı kutusunu sorguyla çizer. Kutu yakın düzlemi kesiyorsa vekil
+    // kırpılır ve sonucu güvenilmez olur: nesne sorgusuz görünür sayılır.
+    void test(size_t object, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+    {
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec3 p(corner & 1 ? boundsMax.x : boundsMin.x, corner & 2 ? boundsMax.y : boundsMin.y,
+                              corner & 4 ? boundsMax.z : boundsMin.z);
+            const glm::vec4 clip = viewProjection * glm::vec4(p, 1.0f);
+            if (clip.z < -clip.w || clip.w <= 0.0f)
+            {
+                objects[object].visible = true;
+                return;
+            }
+        }
+
+        GLuint query = 0;
+        if (queryPool.empty())
+            glGenQueries(1, &query);
+        else
+        {
+            query = queryPool.back();
+            queryPool.pop_back();
+        }
+
+        program.set(boundsMinUniform, boundsMin - glm::vec3(QUERY_PROXY_MARGIN));
+        program.set(boundsMaxUniform, boundsMax + glm::vec3(QUERY_PROXY_MARGIN));
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, query);
+        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_BYTE, (void *)0);
+        glEndQuery(GL_ANY_SAMPLES_PASSED);
+
+        Pending p;
+        p.query = query;
+        p.object = (uint32_t)object;
+        pending.push_back(p);
+        ObjectState &state = objects[object];
+        state.query = query;
+        ++state.pendingCount;
+        ++frameStats.issued;
+        ++totals.issued;
+    }
+
+    void endProxies()
+    {
+        glState().setColorMask(true);
+        glState().setDepthMask(true);
+    }
+
+    // Nesnenin bu karedeki sorgusu varsa koşullu çizim başlar (GPU sonucu
+    // bekler, CPU beklemez); yoksa false döner ve nesne koşulsuz çizilir.
+    // Sorgu o anda bitmemişse GPU bekleyebilir; bu durum sayılır
+    bool beginConditional(size_t object)
+    {
+        const GLuint query = objects[object].query;
+        if (!query)
+            return false;
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+        {
+            ++frameStats.gpuWaits;
+            ++totals.gpuWaits;
+        }
+        glBeginConditionalRender(query, GL_QUERY_WAIT);
+        ++frameStats.conditional;
+        ++totals.conditional;
+        return true;
+    }
+
+    void endConditional()
+    {
+        glEndConditionalRender();
+    }
+
+    // Son karenin sayaçları
+    const OcclusionQueryStats &stats() const
+    {
+        return frameStats;
+    }
+
+    // Bütün çalışma boyunca toplanan sayaçlar
+    const OcclusionQueryStats &totalStats() const
+    {
+        return totals;
+    }
+
+private:
+    struct ObjectState
+    {
+        bool visible = true;
+        unsigned pendingCount = 0;
+        GLuint query = 0; // Bu karede çizilen vekilin sorgusu
+    };
+
+    struct Pending
+    {
+        GLuint query;
+        uint32_t object;
+    };
+
+    static constexpr const char *proxyVertexSource = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos; // Birim küp köşesi
+uniform mat4 viewProjection;
+uniform vec3 boundsMin;
+uniform vec3 boundsMax;
+void main()
+{
+    gl_Position = viewProjection * vec4(mix(boundsMin, boundsMax, aPos), 1.0);
+}
+)";
+
+    static constexpr const char *proxyFragmentSource = R"(
+#version 330 core
+out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(1.0);
+}
+)";
+
+    std::vector<ObjectState> objects;
+    std::vector<Pending> pending;
+    std::vector<GLuint> queryPool;
+    ShaderProgram program;
+    UniformHandle viewProjectionUniform, boundsMinUniform, boundsMaxUniform;
+    GLuint vertexArray = 0, vertexBuffer = 0, indexBuffer = 0;
+    glm::mat4 viewProjection = glm::mat4(1.0f);
+    uint64_t frameIndex = 0;
+    OcclusionQueryStats frameStats;
+    OcclusionQueryStats totals;
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// İşçi iş parçacığı sayısı: donanımın bildirdiği kadar, en az 1
+inline unsigned workerCount()
+{
+    unsigned count = std::thread::hardware_concurrency();
+    return count > 0 ? count : 1;
+}
+
+// fn(0) .. fn(taskCount - 1) çağrılarını işçi iş parçacıklarına dağıtır; her
+// işçi sıradaki görevi atomik bir sayaçtan alır, böylece farklı boyuttaki
+// görevler kendiliğinden dengelenir. Çağıran iş parçacığı da çalışır ve fonksiyon
+// bütün görevler bitince döner. Görevler birbirinden bağımsız olmalı.
+template <class Fn>
+void parallelFor(size_t taskCount, Fn fn, unsigned maxWorkers = 0)
+{
+    unsigned workers = maxWorkers > 0 ? maxWorkers : workerCount();
+    workers = (unsigned)std::min<size_t>(workers, taskCount);
+    if (workers <= 1)
+    {
+        for (size_t i = 0; i < taskCount; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    auto work = [&]()
+    {
+        for (size_t i = next++; i < taskCount; i = next++)
+            fn(i);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned i = 1; i < workers; ++i)
+        threads.emplace_back(work);
+    work();
+    for (std::thread &thread : threads)
+        thread.join();
+}
+
+// Kalıcı işçi havuzu: her karede tekrarlanan kısa işler için (ör. yazılım
+// örtme tamponu). parallelFor'dan farkı iş parçacıklarının bir kere
+// yaratılıp görev bekleyerek uyumasıdır; run() aynı atomik sayaç düzeniyle
+// görevleri dağıtır, çağıran iş parçacığı da çalışır ve hepsi bitince döner.
+class WorkerPool
+{
+public:
+    explicit WorkerPool(unsigned workers = 0)
+    {
+        const unsigned count = workers > 0 ? workers : workerCount();
+        for (unsigned i = 1; i < count; ++i)
+            threads.emplace_back([this]()
+                                 { workerLoop(); });
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &thread : threads)
+            thread.join();
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    unsigned size() const
+    {
+        return (unsigned)threads.size() + 1;
+    }
+
+    // fn(0) .. fn(taskCount - 1); görevler birbirinden bağımsız olmalı
+    void run(size_t taskCount, const std::function<void(size_t)> &fn)
+    {
+        if (threads.empty() || taskCount <= 1)
+        {
+            for (size_t i = 0; i < taskCount; ++i)
+                fn(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = &fn;
+            tasks = taskCount;
+            next = 0;
+            active = (unsigned)threads.size();
+            ++generation;
+        }
+        wake.notify_all();
+        work(fn, taskCount);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]()
+                      { return active == 0; });
+        task = nullptr;
+    }
+
+private:
+    void work(const std::function<void(size_t)> &fn, size_t taskCount)
+    {
+        for (size_t i = next++; i < taskCount; i = next++)
+            fn(i);
+    }
+
+    void workerLoop()
+    {
+        size_t seen = 0;
+        while (true)
+        {
+            const std::function<void(size_t)> *fn;
+            size_t taskCount;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]()
+                          { return stopping || generation != seen; });
+                if (stopping)
+                    return;
+                seen = generation;
+                fn = task;
+                taskCount = tasks;
+            }
+            work(*fn, taskCount);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--active == 0)
+                    finished.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake, finished;
+    const std::function<void(size_t)> *task = nullptr;
+    size_t tasks = 0;
+    std::atomic<size_t> next{0};
+    size_t generation = 0;
+    unsigned active = 0;
+    bool stopping = false;
+};
+
+#endif
@@ -0,0 +1,342 @@
+#ifndef PROCEDURAL_MESH_H
+#define PROCEDURAL_MESH_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "parallel.h"
+#include "vertex_format.h"
+
+// Prosedürel primitifler. Hepsi y ekseni etrafında dönel yüzeydir (lathe): bir
+// profil eğrisinin her noktası segments + 1 vertexlik bir satır olur, ardışık
+// satırlar arası dörtgenlerle örülür. Böylece vertex ve indeks sayıları
+// üretimden önce tam olarak bilinir, her satır bağımsız olarak (başka satıra
+// bakmadan) doğrudan hedef belleğe yazılır ve satırlar iş parçacıklarına
+// bölünebilir. Çıktı 9 float'lık düzenden değil, doğrudan seçilen vertex
+// düzeninde (VertexLayout) üretilir.
+enum ProceduralShape
+{
+    PROCEDURAL_SPHERE,
+    PROCEDURAL_CYLINDER,
+    PROCEDURAL_CONE,
+    PROCEDURAL_TORUS,
+};
+
+struct ProceduralMeshDesc
+{
+    ProceduralShape shape = PROCEDURAL_SPHERE;
+    float radius = 0.5f; // Küre, silindir ve koni yarıçapı; torusta halka yarıçapı
+    float size = 1.0f;   // Silindir ve koni yüksekliği; torusta tüp yarıçapı
+    int segments = 16;   // y ekseni etrafındaki bölüm sayısı
+    int rings = 8;       // Küre: enlem, torus: tüp çevresi, silindir / koni: gövde bölümü
+    glm::vec3 color = glm::vec3(1.0f);
+    glm::vec3 origin = glm::vec3(0.0f); // Küre ve torusta merkez, silindir ve konide taban merkezi
+};
+
+inline ProceduralMeshDesc sphereMesh(float radius, int segments, int rings, glm::vec3 color,
+                                     glm::vec3 origin = glm::vec3(0.0f))
+{
+    ProceduralMeshDesc desc;
+    desc.shape = PROCEDURAL_SPHERE;
+    desc.radius = radius;
+    desc.segments = segments;
+    desc.rings = rings;
+    desc.color = color;
+    desc.origin = origin;
+    return desc;
+}
+
+inline ProceduralMeshDesc cylinderMesh(float radius, float height, int segments, glm::vec3 color,
+                                       glm::vec3 origin = glm::vec3(0.0f))
+{
+    ProceduralMeshDesc desc = sphereMesh(radius, segments, 1, color, origin);
+    desc.shape = PROCEDURAL_CYLINDER;
+    desc.size = height;
+    return desc;
+}
+
+inline ProceduralMeshDesc coneMesh(float radius, float height, int segments, glm::vec3 color,
+                                   glm::vec3 origin = glm::vec3(0.0f))
+{
+    ProceduralMeshDesc desc = cylinderMesh(radius, height, segments, color, origin);
+    desc.shape = PROCEDURAL_CONE;
+    return desc;
+}
+
+inline ProceduralMeshDesc torusMesh(float radius, float tubeRadius, int segments, int rings, glm::vec3 color,
+                                    glm::vec3 origin = glm::vec3(0.0f))
+{
+    ProceduralMeshDesc desc = sphereMesh(radius, segments, rings, color, origin);
+    desc.shape = PROCEDURAL_TORUS;
+    desc.size = tubeRadius;
+    return desc;
+}
+
+// Profil noktası: eksene uzaklık, yükseklik ve profil düzlemindeki normal.
+// connect false ise bu satır ile sonraki arasında üçgen yoktur; keskin
+// kenarlarda (kapak - gövde) aynı konum iki farklı normalle tekrarlanır.
+struct ProfilePoint
+{
+    float radius;
+    float y;
+    float normalRadial;
+    float normalY;
+    bool connect;
+};
+
+// Profil her şekilde eksenin dışında aşağıdan yukarı (torusta tüpün dış
+// yüzünden başlayarak) ilerler; bu yüzden bütün şekillerde sarma yönü aynıdır.
+inline int profileCount(const ProceduralMeshDesc &desc)
+{
+    switch (desc.shape)
+    {
+    case PROCEDURAL_CYLINDER:
+        return desc.rings + 5; // alt merkez, alt kenar, gövde satırları, üst kenar, üst merkez
+    case PROCEDURAL_CONE:
+        return desc.rings + 3; // taban merkezi, taban kenarı, gövde satırları (son satır tepe)
+    default:
+        return desc.rings + 1;
+    }
+}
+
+inline ProfilePoint profilePoint(const ProceduralMeshDesc &desc, int k)
+{
+    const float pi = 3.14159265358979f;
+    const int last = profileCount(desc) - 1;
+    const float r = desc.radius;
+    const float h = desc.size;
+
+    switch (desc.shape)
+    {
+    case PROCEDURAL_CYLINDER:
+        if (k == 0)
+            return {0.0f, 0.0f, 0.0f, -1.0f, true};
+        if (k == 1)
+            return {r, 0.0f, 0.0f, -1.0f, false};
+        if (k == last - 1)
+            return {r, h, 0.0f, 1.0f, true};
+        if (k == last)
+            return {0.0f, h, 0.0f, 1.0f, false};
+        return {r, h * (float)(k - 2) / (float)desc.rings, 1.0f, 0.0f, k < last - 2};
+    case PROCEDURAL_CONE:
+    {
+        if (k == 0)
+            return {0.0f, 0.0f, 0.0f, -1.0f, true};
+        if (k == 1)
+            return {r, 0.0f, 0.0f, -1.0f, false};
+        // Yan yüzün normali profilin (r, 0) -> (0, h) doğrusuna diktir
+        const float t = (float)(k - 2) / (float)desc.rings;
+        const float length = std::sqrt(h * h + r * r);
+        return {k == last ? 0.0f : r * (1.0f - t), h * t, h / length, r / length, k < last};
+    }
+    case PROCEDURAL_TORUS:
+    {
+        const float psi = 2.0f * pi * (float)k / (float)desc.rings;
+        const float c = k == last ? 1.0f : std::cos(psi);
+        const float s = k == last ? 0.0f : std::sin(psi);
+        return {r + h * c, h * s, c, s, k < last};
+    }
+    default:
+    {
+        // Güney kutbundan kuzeye; kutuplarda yarıçap tam 0 (üçgen yelpazesi)
+        const float phi = pi * (float)k / (float)desc.rings;
+        const float s = (k == 0 || k == last) ? 0.0f : std::sin(phi);
+        const float c = -std::cos(phi);
+        return {r * s, r * c, s, c, k < last};
+    }
+    }
+}
+
+// İki satır arasındaki hücre başına üçgen: uçlardan biri eksendeyse 1, değilse 2
+inline int profileTriangles(const ProfilePoint &p, const ProfilePoint &q)
+{
+    if (!p.connect)
+        return 0;
+    return (p.radius == 0.0f || q.radius == 0.0f) ? 1 : 2;
+}
+
+struct ProceduralMeshSize
+{
+    size_t vertexCount;
+    size_t indexCount;
+};
+
+// Üretimden önce tam boyutlar (tampon bir kere, tam boyutta ayrılır)
+inline ProceduralMeshSize proceduralMeshSize(const ProceduralMeshDesc &desc)
+{
+    const int rows = profileCount(desc);
+    ProceduralMeshSize size;
+    size.vertexCount = (size_t)rows * (desc.segments + 1);
+    size.indexCount = 0;
+    ProfilePoint p = profilePoint(desc, 0);
+    for (int k = 0; k + 1 < rows; ++k)
+    {
+        ProfilePoint q = profilePoint(desc, k + 1);
+        size.indexCount += (size_t)profileTriangles(p, q) * 3 * desc.segments;
+        p = q;
+    }
+    return size;
+}
+
+// Model uzayında eksen hizalı sınır kutusu (analitik)
+inline void proceduralMeshBounds(const ProceduralMeshDesc &desc, glm::vec3 &boundsMin, glm::vec3 &boundsMax)
+{
+    switch (desc.shape)
+    {
+    case PROCEDURAL_CYLINDER:
+    case PROCEDURAL_CONE:
+        boundsMin = glm::vec3(-desc.radius, 0.0f, -desc.radius);
+        boundsMax = glm::vec3(desc.radius, desc.size, desc.radius);
+        break;
+    case PROCEDURAL_TORUS:
+        boundsMin = glm::vec3(-desc.radius - desc.size, -desc.size, -desc.radius - desc.size);
+        boundsMax = glm::vec3(desc.radius + desc.size, desc.size, desc.radius + desc.size);
+        break;
+    default:
+        boundsMin = glm::vec3(-desc.radius);
+        boundsMax = glm::vec3(desc.radius);
+        break;
+    }
+    boundsMin += desc.origin;
+    boundsMax += desc.origin;
+}
+
+// [rowBegin, rowEnd) satırlarının vertexlerini ve bu satırlardan bir sonrakine
+// uzanan hücrelerin indekslerini yazar. vertices ve indices meshin başını
+// gösterir; indeksler baseVertex'e göredir. Farklı satır aralıkları aynı anda
+// farklı iş parçacıklarından yazılabilir.
+template <class Layout, class Index>
+void writeProceduralRows(const ProceduralMeshDesc &desc, unsigned char *vertices, Index *indices,
+                         uint32_t baseVertex, int rowBegin, int rowEnd)
+{
+    const int rows = profileCount(desc);
+    const int segments = desc.segments;
+    const uint32_t columns = (uint32_t)segments + 1;
+
+    // Bu aralıktan önceki satırların indeks sayısı
+    size_t indexOffset = 0;
+    ProfilePoint p = profilePoint(desc, 0);
+    for (int k = 0; k < rowBegin; ++k)
+    {
+        ProfilePoint q = profilePoint(desc, k + 1);
+        indexOffset += (size_t)profileTriangles(p, q) * 3 * segments;
+        p = q;
+    }
+    Index *out = indices + indexOffset;
+
+    // Açı adımı karmaşık çarpımla ilerler (vertex başına sin/cos yok); double
+    // hassasiyetle binlerce bölümde de dikiş kapanır
+    const double step = 2.0 * 3.14159265358979323846 / segments;
+    const double stepCos = std::cos(step), stepSin = std::sin(step);
+
+    for (int k = rowBegin; k < rowEnd; ++k)
+    {
+        unsigned char *dst = vertices + (size_t)k * columns * Layout::stride;
+        double c = 1.0, s = 0.0;
+        for (int j = 0; j <= segments; ++j)
+        {
+            const float x = j == segments ? 1.0f : (float)c;
+            const float z = j == segments ? 0.0f : -(float)s;
+            const float vertex[9] = {desc.origin.x + p.radius * x, desc.origin.y + p.y, desc.origin.z + p.radius * z,
+                                     p.normalRadial * x, p.normalY, p.normalRadial * z,
+                                     desc.color.r, desc.color.g, desc.color.b};
+            encodeVertex<Layout>(dst, vertex);
+            dst += Layout::stride;
+
+            const double nextCos = c * stepCos - s * stepSin;
+            s = s * stepCos + c * stepSin;
+            c = nextCos;
+        }
+
+        if (k + 1 >= rows)
+            break;
+        const ProfilePoint q = profilePoint(desc, k + 1);
+        const int triangles = profileTriangles(p, q);
+        const uint32_t row = baseVertex + (uint32_t)k * columns;
+        for (uint32_t j = 0; triangles > 0 && j < (uint32_t)segments; ++j)
+        {
+            const uint32_t a = row + j, b = a + 1, d = a + columns, e = d + 1;
+            if (p.radius != 0.0f)
+            {
+                *out++ = (Index)a;
+                *out++ = (Index)b;
+                *out++ = (Index)d;
+            }
+            if (q.radius != 0.0f)
+            {
+                *out++ = (Index)b;
+                *out++ = (Index)e;
+                *out++ = (Index)d;
+            }
+        }
+        p = q;
+    }
+}
+
+// CPU'da 9 float'lık vertex ve 32 bit indeks olarak vektörlerin sonuna ekler;
+// indeksler meshin ilk vertexine göredir. Vektörler bir kere, tam boyuta büyür.
+inline void generateProceduralMesh(const ProceduralMeshDesc &desc, std::vector<float> &vertices, std::vector<uint32_t> &indices)
+{
+    const ProceduralMeshSize size = proceduralMeshSize(desc);
+    const size_t firstFloat = vertices.size();
+    const size_t firstIndex = indices.size();
+    vertices.resize(firstFloat + size.vertexCount * 9);
+    indices.resize(firstIndex + size.indexCount);
+    writeProceduralRows<FloatVertexLayout, uint32_t>(desc, (unsigned char *)(vertices.data() + firstFloat),
+                                                     indices.data() + firstIndex, 0, 0, profileCount(desc));
+}
+
+// Bir meshin hedef tampondaki yeri (vertex ve indeks cinsinden)
+struct ProceduralMeshTarget
+{
+    ProceduralMeshDesc desc;
+    size_t firstVertex;
+    size_t firstIndex;
+};
+
+// Görev başına yaklaşık vertex sayısı ve iş parçacığı kullanmaya değecek en az toplam
+const size_t PROCEDURAL_TASK_VERTICES = 16384;
+const size_t PROCEDURAL_PARALLEL_MIN_VERTICES = 65536;
+
+// Bütün meshleri eşlenmiş vertex / indeks belleğine üretir. Yüksek çözünürlüklü
+// meshler satır gruplarına bölünür, küçük meshler tek görevdir; görevler
+// parallelFor ile dağıtılır. İndeksler her meshin ilk vertexine göredir
+// (glDrawElementsBaseVertex ile çizilir).
+template <class Layout, class Index>
+void writeProceduralMeshes(const std::vector<ProceduralMeshTarget> &meshes, unsigned char *vertices, Index *indices)
+{
+    struct Task
+    {
+        size_t mesh;
+        int rowBegin;
+        int rowEnd;
+    };
+    std::vector<Task> tasks;
+    size_t totalVertices = 0;
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        const int rows = profileCount(meshes[i].desc);
+        const size_t columns = (size_t)meshes[i].desc.segments + 1;
+        const int rowsPerTask = (int)std::max<size_t>(1, PROCEDURAL_TASK_VERTICES / columns);
+        for (int row = 0; row < rows; row += rowsPerTask)
+            tasks.push_back({i, row, std::min(rows, row + rowsPerTask)});
+        totalVertices += rows * columns;
+    }
+
+    parallelFor(
+        tasks.size(),
+        [&](size_t t)
+        {
+            const Task &task = tasks[t];
+            const ProceduralMeshTarget &mesh = meshes[task.mesh];
+            writeProceduralRows<Layout, Index>(mesh.desc, vertices + mesh.firstVertex * Layout::stride,
+                                               indices + mesh.firstIndex, 0, task.rowBegin, task.rowEnd);
+        },
+        totalVertices < PROCEDURAL_PARALLEL_MIN_VERTICES ? 1 : 0);
+}
+
+#endif
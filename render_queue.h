@@ -0,0 +1,205 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "mesh_arena.h"
+#include "shader_program.h"
+#include "static_batch.h"
+
+// Çizim geçişleri; anahtarın en yüksek bitleri olduğu için sırayla çizilirler
+enum RenderPass
+{
+    RENDER_PASS_OPAQUE = 0,
+    RENDER_PASS_TRANSPARENT = 1,
+};
+
+// 64 bit çizim anahtarı (yüksek bitten düşüğe):
+//   63-62 geçiş | 61-56 program | 55-48 VAO | 47-40 malzeme | 39-16 derinlik | 15-0 boş
+// Sıralama önce durum değişikliklerini gruplar, grup içinde opak nesneleri
+// önden arkaya, saydamları arkadan öne dizer.
+const int RENDER_KEY_PASS_SHIFT = 62;
+const int RENDER_KEY_PROGRAM_SHIFT = 56;
+const int RENDER_KEY_VAO_SHIFT = 48;
+const int RENDER_KEY_MATERIAL_SHIFT = 40;
+const int RENDER_KEY_DEPTH_SHIFT = 16;
+const uint32_t RENDER_KEY_DEPTH_MAX = (1u << 24) - 1;
+
+inline uint64_t makeRenderKey(unsigned pass, unsigned program, unsigned vao, unsigned material, uint32_t depth)
+{
+    if (pass == RENDER_PASS_TRANSPARENT)
+        depth = RENDER_KEY_DEPTH_MAX - depth;
+    return ((uint64_t)(pass & 0x3) << RENDER_KEY_PASS_SHIFT) |
+           ((uint64_t)(program & 0x3F) << RENDER_KEY_PROGRAM_SHIFT) |
+           ((uint64_t)(vao & 0xFF) << RENDER_KEY_VAO_SHIFT) |
+           ((uint64_t)(material & 0xFF) << RENDER_KEY_MATERIAL_SHIFT) |
+           ((uint64_t)(depth & RENDER_KEY_DEPTH_MAX) << RENDER_KEY_DEPTH_SHIFT);
+}
+
+// Meshin sınır kutusu merkezinin kameraya göre derinliği (view uzayında -z)
+inline float viewDepth(const glm::mat4 &view, const glm::mat4 &model, const MeshRange &range)
+{
+    glm::vec3 center = (range.boundsMin + range.boundsMax) * 0.5f;
+    return -(view * (model * glm::vec4(center, 1.0f))).z;
+}
+
+// Anahtarın taşıdığı çizim: arenadan bir aralık ya da arenadaki statik yığın
+// (arena + batch)
+struct RenderCommand
+{
+    int program = 0; // RenderQueue::addProgram'ın döndürdüğü sıra
+    const MeshArena *arena = nullptr;
+    MeshRange range;
+    GLenum mode = GL_TRIANGLES;
+    int drawIndex = -1; // TransformBuffer indeksi; -1 ise kullanılmaz
+    const StaticBatch *batch = nullptr;
+};
+
+// Her karede doldurulan, anahtara göre radix sort ile sıralanıp çizilen kuyruk
+class RenderQueue
+{
+public:
+    // Sadece yükleme sırasında; dönen değer RenderCommand::program olarak kullanılır
+    int addProgram(ShaderProgram &program)
+    {
+        ProgramSlot slot;
+        slot.program = &program;
+        slot.drawIndex = program.uniform("drawIndex");
+        programs.push_back(slot);
+        return (int)programs.size() - 1;
+    }
+
+    // Yeni kare; derinlikler [nearPlane, farPlane] aralığında nicemlenir
+    void begin(float nearPlane, float farPlane)
+    {
+        depthNear = nearPlane;
+        depthFar = farPlane;
+        entries.clear();
+        commands.clear();
+    }
+
+    void submit(const RenderCommand &command, float depth, unsigned pass = RENDER_PASS_OPAQUE, unsigned material = 0)
+    {
+        GLuint vao = command.arena->vertexArray();
+        // VAO adının düşük 8 biti: çakışma sadece gruplamayı bozar, sonucu değil
+        Entry entry;
+        entry.key = makeRenderKey(pass, (unsigned)command.program, vao, material, quantizeDepth(depth));
+        entry.index = (uint32_t)commands.size();
+        entries.push_back(entry);
+        commands.push_back(command);
+    }
+
+    // LSD radix sort, 8 bitlik 8 geçiş; bütün anahtarlarda aynı olan baytlar atlanır
+    void sort()
+    {
+        if (entries.size() < 2)
+            return;
+
+        scratch.resize(entries.size());
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            size_t counts[256] = {};
+            for (const Entry &e : entries)
+                ++counts[(e.key >> shift) & 0xFF];
+            if (counts[(entries[0].key >> shift) & 0xFF] == entries.size())
+                continue;
+
+            size_t offset = 0;
+            for (size_t &count : counts)
+            {
+                size_t c = count;
+                count = offset;
+                offset += c;
+            }
+            for (const Entry &e : entries)
+                scratch[counts[(e.key >> shift) & 0xFF]++] = e;
+            entries.swap(scratch);
+        }
+    }
+
+    // Sıralı çizim; program ve VAO sadece grup değiştiğinde bağlanır
+    void execute()
+    {
+        int currentProgram = -1;
+        GLuint currentVao = 0;
+        programChanges = vaoChanges = 0;
+
+        for (const Entry &e : entries)
+        {
+            const RenderCommand &command = commands[e.index];
+            ProgramSlot &slot = programs[command.program];
+            if (command.program != currentProgram)
+            {
+                slot.program->use();
+                currentProgram = command.program;
+                ++programChanges;
+            }
+
+            GLuint vao = command.arena->vertexArray();
+            if (vao != currentVao)
+            {
+                glState().bindVertexArray(vao);
+                currentVao = vao;
+                ++vaoChanges;
+            }
+
+            if (command.drawIndex >= 0)
+                slot.program->set(slot.drawIndex, command.drawIndex);
+
+            if (command.batch)
+                command.batch->draw();
+            else
+                command.arena->draw(command.range, command.mode);
+        }
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    // İstatistik: son execute() içindeki program ve VAO değişimleri
+    unsigned int programChangeCount() const
+    {
+        return programChanges;
+    }
+
+    unsigned int vaoChangeCount() const
+    {
+        return vaoChanges;
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    struct ProgramSlot
+    {
+        ShaderProgram *program;
+        UniformHandle drawIndex;
+    };
+
+    uint32_t quantizeDepth(float depth) const
+    {
+        float t = (depth - depthNear) / (depthFar - depthNear);
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        return (uint32_t)(t * (float)RENDER_KEY_DEPTH_MAX);
+    }
+
+    std::vector<ProgramSlot> programs;
+    std::vector<Entry> entries;
+    std::vector<Entry> scratch;
+    std::vector<RenderCommand> commands;
+    float depthNear = 0.1f;
+    float depthFar = 100.0f;
+    unsigned int programChanges = 0;
+    unsigned int vaoChanges = 0;
+};
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef SHADER_PROGRAM_H
+#define SHADER_PROGRAM_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gl_state.h"
+
+// Vertex ve fragment shader kaynaklarından program oluşturma
+inline GLuint createShaderProgram(const char *vertexSource, const char *fragmentSource)
+{
+    GLuint shaderProgram = glCreateProgram();
+
+    // Vertex shader
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, NULL);
+    glCompileShader(vertexShader);
+
+    // Vertex shader derleme kontrolü
+    int success;
+    char infoLog[512];
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
+        std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
+                  << infoLog << std::endl;
+    }
+
+    // Fragment shader
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+    glCompileShader(fragmentShader);
+
+    // Fragment shader derleme kontrolü
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
+        std::cerr << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
+                  << infoLog << std::endl;
+    }
+
+    // Shader programını link et
+    glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    glLinkProgram(shaderProgram);
+
+    // Shader programı link kontrolü
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+        std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
+                  << infoLog << std::endl;
+    }
+
+    // Shader objeleri artık gerekli değil
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    return shaderProgram;
+}
+
+// Programdaki bir uniforma link sırasında çözülmüş erişim anahtarı.
+// Shaderda bulunmayan (ya da derleyicinin attığı) uniformlar için index = -1
+// olur ve setterlar hiçbir şey yapmaz.
+struct UniformHandle
+{
+    int index = -1;
+};
+
+// Link sonrası aktif uniform ve attributeları glGetActiveUniform /
+// glGetActiveAttrib ile listeleyip konumlarını saklayan program nesnesi.
+// Setterlar son yüklenen değeri hatırlar; değer değişmediyse GL çağrısı yapılmaz.
+// Setterlar program bağlıyken (use() sonrası) çağrılmalıdır.
+class ShaderProgram
+{
+public:
+    ShaderProgram() = default;
+
+    explicit ShaderProgram(GLuint program)
+        : id(program)
+    {
+        reflect();
+    }
+
+    GLuint handle() const
+    {
+        return id;
+    }
+
+    void use() const
+    {
+        glState().useProgram(id);
+    }
+
+    // Sadece yükleme sırasında çağrılmalı; kare içinde UniformHandle kullanılır
+    UniformHandle uniform(const char *name) const
+    {
+        UniformHandle h;
+        auto it = uniformIndices.find(name);
+        if (it != uniformIndices.end())
+            h.index = it->second;
+        return h;
+    }
+
+    GLint uniformLocation(const char *name) const
+    {
+        UniformHandle h = uniform(name);
+        return h.index < 0 ? -1 : uniforms[h.index].location;
+    }
+
+    // GLSL 330'da layout(binding) olmadığı için bloklar sabit noktalara buradan bağlanır
+    void bindUniformBlock(const char *name, GLuint binding) const
+    {
+        GLuint blockIndex = glGetUniformBlockIndex(id, name);
+        if (blockIndex != GL_INVALID_INDEX)
+            glUniformBlockBinding(id, blockIndex, binding);
+    }
+
+    GLint attributeLocation(const char *name) const
+    {
+        auto it = attributes.find(name);
+        return it == attributes.end() ? -1 : it->second;
+    }
+
+    void set(UniformHandle h, int value)
+    {
+        if (changed(h, &value, sizeof(value)))
+            glUniform1i(uniforms[h.index].location, value);
+    }
+
+    void set(UniformHandle h, float value)
+    {
+        if (changed(h, &value, sizeof(value)))
+            glUniform1f(uniforms[h.index].location, value);
+    }
+
+    void set(UniformHandle h, const glm::vec3 &value)
+    {
+        if (changed(h, glm::value_ptr(value), sizeof(value)))
+            glUniform3fv(uniforms[h.index].location, 1, glm::value_ptr(value));
+    }
+
+    void set(UniformHandle h, const glm::vec4 &value)
+    {
+        if (changed(h, glm::value_ptr(value), sizeof(value)))
+            glUniform4fv(uniforms[h.index].location, 1, glm::value_ptr(value));
+    }
+
+    void set(UniformHandle h, const glm::mat3 &value)
+    {
+        if (changed(h, glm::value_ptr(value), sizeof(value)))
+            glUniformMatrix3fv(uniforms[h.index].location, 1, GL_FALSE, glm::value_ptr(value));
+    }
+
+    void set(UniformHandle h, const glm::mat4 &value)
+    {
+        if (changed(h, glm::value_ptr(value), sizeof(value)))
+            glUniformMatrix4fv(uniforms[h.index].location, 1, GL_FALSE, glm::value_ptr(value));
+    }
+
+    // İstatistik: yapılan ve atlanan uniform yüklemeleri
+    unsigned int uploadCount() const
+    {
+        return uploads;
+    }
+
+    unsigned int skippedCount() const
+    {
+        return skipped;
+    }
+
+    void resetCounters()
+    {
+        uploads = skipped = 0;
+    }
+
+    void destroy()
+    {
+        glDeleteProgram(id);
+        id = 0;
+    }
+
+private:
+    struct Uniform
+    {
+        GLint location;
+        GLenum type;
+        GLint size;
+        bool valid;              // Henüz hiç yüklenmediyse false
+        unsigned char cache[64]; // En büyük tip mat4
+    };
+
+    void reflect()
+    {
+        GLint count = 0, maxLength = 0;
+        glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        std::vector<char> name(maxLength > 0 ? maxLength : 1);
+
+        for (GLint i = 0; i < count; ++i)
+        {
+            Uniform u = {};
+            GLsizei length = 0;
+            glGetActiveUniform(id, (GLuint)i, maxLength, &length, &u.size, &u.type, name.data());
+            std::string uniformName(name.data(), length);
+
+            // Dizilerin adı "isim[0]" olarak gelir
+            size_t bracket = uniformName.find('[');
+            if (bracket != std::string::npos)
+                uniformName.erase(bracket);
+
+            // Uniform bloklarındaki üyelerin konumu yoktur
+            u.location = glGetUniformLocation(id, name.data());
+            if (u.location < 0)
+                continue;
+
+            uniformIndices[uniformName] = (int)uniforms.size();
+            uniforms.push_back(u);
+        }
+
+        glGetProgramiv(id, GL_ACTIVE_ATTRIBUTES, &count);
+        glGetProgramiv(id, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+        name.resize(maxLength > 0 ? maxLength : 1);
+
+        for (GLint i = 0; i < count; ++i)
+        {
+            GLint size;
+            GLenum type;
+            GLsizei length = 0;
+            glGetActiveAttrib(id, (GLuint)i, maxLength, &length, &size, &type, name.data());
+            attributes[std::string(name.data(), length)] = glGetAttribLocation(id, name.data());
+        }
+    }
+
+    // Değer son yüklenenden farklıysa önbelleği günceller ve true döner
+    bool changed(UniformHandle h, const void *data, size_t size)
+    {
+        if (h.index < 0)
+            return false;
+
+        Uniform &u = uniforms[h.index];
+        if (u.valid && std::memcmp(u.cache, data, size) == 0)
+        {
+            ++skipped;
+            return false;
+        }
+
+        std::memcpy(u.cache, data, size);
+        u.valid = true;
+        ++uploads;
+        return true;
+    }
+
+    GLuint id = 0;
+    std::vector<Uniform> uniforms;
+    std::unordered_map<std::string, int> uniformIndices;
+    std::unordered_map<std::string, GLint> attributes;
+    unsigned int uploads = 0;
+    unsigned int skipped = 0;
+};
+
+#endif
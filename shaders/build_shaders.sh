@@ -0,0 +1,19 @@
+#!/bin/sh
+# Vulkan yolunun shaderlarını SPIR-V'ye derler (Vulkan SDK'daki glslc ya da
+# glslangValidator gerekir). Herhangi bir dizinden çalıştırılabilir; .spv
+# dosyaları kaynakların yanına yazılır.
+set -e
+cd "$(dirname "$0")"
+
+for stage in vert frag; do
+    src=vulkan_scene.$stage
+    if command -v glslc >/dev/null 2>&1; then
+        glslc "$src" -o "$src.spv"
+    elif command -v glslangValidator >/dev/null 2>&1; then
+        glslangValidator -V "$src" -o "$src.spv"
+    else
+        echo "ERROR::SHADERS::COMPILER_NOT_FOUND glslc veya glslangValidator bulunamadı (Vulkan SDK)" >&2
+        exit 1
+    fi
+    echo "$src -> $src.spv"
+done
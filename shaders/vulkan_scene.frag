@@ -0,0 +1,40 @@
+#version 450
+
+layout (set = 0, binding = 0) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 lightPos;
+    vec4 viewPos;
+    vec4 lightColor;
+} frame;
+
+layout (location = 0) in vec3 FragPos;
+layout (location = 1) in vec3 Normal;
+layout (location = 2) in vec3 Color;
+
+layout (location = 0) out vec4 FragColor;
+
+// main.cpp'deki fragmentShaderSource ile aynı Phong aydınlatması
+void main() {
+    // Ambient
+    float ambientStrength = 0.3;
+    vec3 ambient = ambientStrength * frame.lightColor.rgb;
+
+    // Diffuse
+    vec3 norm = normalize(Normal);
+    vec3 lightDir = normalize(frame.lightPos.xyz - FragPos);
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec3 diffuse = diff * frame.lightColor.rgb;
+
+    // Specular
+    float specularStrength = 0.5;
+    vec3 viewDir = normalize(frame.viewPos.xyz - FragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
+    vec3 specular = specularStrength * spec * frame.lightColor.rgb;
+
+    vec3 result = (ambient + diffuse + specular) * Color;
+    FragColor = vec4(result, 1.0);
+}
@@ -0,0 +1,35 @@
+#version 450
+
+// main.cpp'deki FrameData bloğunun Vulkan karşılığı (std140, set 0 binding 0)
+layout (set = 0, binding = 0) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 lightPos;
+    vec4 viewPos;
+    vec4 lightColor;
+} frame;
+
+// Nesne başına veri push constant olarak (VulkanObjectData, 112 bayt)
+layout (push_constant) uniform ObjectData
+{
+    mat4 model;
+    vec4 normalMatrix[3];
+} object;
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec3 aColor;
+
+layout (location = 0) out vec3 FragPos;
+layout (location = 1) out vec3 Normal;
+layout (location = 2) out vec3 Color;
+
+void main() {
+    vec4 worldPos = object.model * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
+    Normal = mat3(object.normalMatrix[0].xyz, object.normalMatrix[1].xyz, object.normalMatrix[2].xyz) * aNormal;
+    Color = aColor;
+    gl_Position = frame.viewProjection * worldPos;
+}
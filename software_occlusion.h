@@ -0,0 +1,242 @@
+#ifndef SOFTWARE_OCCLUSION_H
+#define SOFTWARE_OCCLUSION_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "culling.h"
+#include "parallel.h"
+
+// Yazılım örtme (occlusion) ayıklaması: seçilen büyük örtücüler (duvarlar,
+// taban, masa) her karede CPU'da küçük bir derinlik tamponuna çizilir, sonra
+// nesnelerin sınır kutuları çizilmeden önce bu tampona karşı test edilir.
+// GPU'ya hiç dokunmaz, hiçbir şey beklemez; yazılım GL'de de aynı çalışır.
+//  - Tampon OCCLUSION_BANDS yatay banda bölünür; her bant bir işçi görevidir
+//    ve bütün üçgenleri kendi satırlarına çizer (bantlar arası kilit yok).
+//  - Satırlar SSE ile dörder piksel ilerler: kenar fonksiyonları ve derinlik
+//    düzlemi dört piksel için birden değerlendirilir.
+//  - Derinlik NDC z'nin [0, 1]'e taşınmış hali; piksel örtücünün en yakın
+//    derinliğini tutar (temizlenince 1 = uzak düzlem).
+// Örtücü pikseli merkezinden örnekler; alçak çözünürlükte bir pikselin
+// kenarından görünen ince aralıklar kaybolabilir, bu yüzden örtücüler büyük
+// ve kapalı yüzeyler seçilmeli.
+const int OCCLUSION_WIDTH = 256;
+const int OCCLUSION_HEIGHT = 128;
+const int OCCLUSION_BANDS = 8;
+
+class SoftwareOcclusion
+{
+public:
+    // Dünya uzayı örtücü üçgenleri (üçer köşe); ön yüz saat yönü tersi,
+    // kameraya arkasını dönen üçgen çizilmez
+    void setOccluders(const std::vector<glm::vec3> &triangles)
+    {
+        occluders = triangles;
+    }
+
+    size_t occluderTriangleCount() const
+    {
+        return occluders.size() / 3;
+    }
+
+    // Örtücüleri bu karenin kamerasıyla tampona çizer
+    void render(const glm::mat4 &viewProjection, WorkerPool &pool)
+    {
+        this->viewProjection = viewProjection;
+        setupTriangles();
+        depth.assign((size_t)OCCLUSION_WIDTH * OCCLUSION_HEIGHT, 1.0f);
+        const int rows = OCCLUSION_HEIGHT / OCCLUSION_BANDS;
+        pool.run(OCCLUSION_BANDS, [&](size_t band)
+                 { rasterizeBand((int)band * rows, (int)band * rows + rows); });
+    }
+
+    // Dünya uzayı kutusu tampondaki örtücülerin tamamen arkasında değilse
+    // görünür. Kutu yakın düzlemi kesiyorsa (kameraya çok yakın) her zaman görünür.
+    bool visible(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) const
+    {
+        if (depth.empty())
+            return true;
+
+        float minX = (float)OCCLUSION_WIDTH, maxX = 0.0f, minY = (float)OCCLUSION_HEIGHT, maxY = 0.0f;
+        float nearest = 1.0f;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            const glm::vec3 p(corner & 1 ? boundsMax.x : boundsMin.x, corner & 2 ? boundsMax.y : boundsMin.y,
+                              corner & 4 ? boundsMax.z : boundsMin.z);
+            const glm::vec4 clip = viewProjection * glm::vec4(p, 1.0f);
+            if (clip.z < -clip.w || clip.w <= 0.0f)
+                return true;
+            const glm::vec3 screen = toScreen(clip);
+            minX = std::min(minX, screen.x);
+            maxX = std::max(maxX, screen.x);
+            minY = std::min(minY, screen.y);
+            maxY = std::max(maxY, screen.y);
+            nearest = std::min(nearest, screen.z);
+        }
+
+        // Kutunun dokunduğu bütün pikseller (muhafazakâr: kısmen örtülen de dahil)
+        const int x0 = std::max(0, (int)std::floor(minX)), x1 = std::min(OCCLUSION_WIDTH - 1, (int)std::floor(maxX));
+        const int y0 = std::max(0, (int)std::floor(minY)), y1 = std::min(OCCLUSION_HEIGHT - 1, (int)std::floor(maxY));
+        if (x0 > x1 || y0 > y1)
+            return false; // Ekranın dışında
+
+        for (int y = y0; y <= y1; ++y)
+        {
+            const float *row = depth.data() + (size_t)y * OCCLUSION_WIDTH;
+            int x = x0;
+#ifdef CULLING_SSE
+            const __m128 objectDepth = _mm_set1_ps(nearest);
+            for (; x + 3 <= x1; x += 4)
+            {
+                if (_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(row + x), objectDepth)))
+                    return true;
+            }
+#endif
+            for (; x <= x1; ++x)
+            {
+                if (row[x] >= nearest)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    const std::vector<float> &depthBuffer() const
+    {
+        return depth;
+    }
+
+private:
+    // Ekran uzayı üçgeni: kenar fonksiyonları E(x, y) = a x + b y + c (içeride
+    // üçü de >= 0) ve derinlik düzlemi z = zx x + zy y + z0
+    struct ScreenTriangle
+    {
+        float a[3], b[3], c[3];
+        float zx, zy, z0;
+        int minX, maxX, minY, maxY;
+    };
+
+    static glm::vec3 toScreen(const glm::vec4 &clip)
+    {
+        const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+        return glm::vec3((ndc.x * 0.5f + 0.5f) * OCCLUSION_WIDTH, (ndc.y * 0.5f + 0.5f) * OCCLUSION_HEIGHT,
+                         ndc.z * 0.5f + 0.5f);
+    }
+
+    // Örtücüleri kırpma uzayına taşır, yakın düzlemde kırpar (Sutherland-
+    // Hodgman, tek düzlem; diğer kenarlar piksel kutusuyla sınırlanır) ve
+    // ekran uzayı üçgenlerini hazırlar
+    void setupTriangles()
+    {
+        triangles.clear();
+        for (size_t i = 0; i + 2 < occluders.size(); i += 3)
+        {
+            glm::vec4 input[3], polygon[4];
+            for (int k = 0; k < 3; ++k)
+                input[k] = viewProjection * glm::vec4(occluders[i + k], 1.0f);
+
+            int count = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                const glm::vec4 &p = input[k], &q = input[(k + 1) % 3];
+                const float dp = p.z + p.w, dq = q.z + q.w; // Yakın düzleme uzaklık (z >= -w içeride)
+                if (dp >= 0.0f)
+                    polygon[count++] = p;
+                if ((dp >= 0.0f) != (dq >= 0.0f))
+                    polygon[count++] = p + (q - p) * (dp / (dp - dq));
+            }
+            for (int k = 1; k + 1 < count; ++k)
+                addTriangle(toScreen(polygon[0]), toScreen(polygon[k]), toScreen(polygon[k + 1]));
+        }
+    }
+
+    void addTriangle(const glm::vec3 &v0, const glm::vec3 &v1, const glm::vec3 &v2)
+    {
+        // Ekran y'si yukarı: ön yüz pozitif alan
+        const float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+        if (area < 1e-8f)
+            return;
+
+        ScreenTriangle t;
+        t.minX = std::max(0, (int)std::floor(std::min(v0.x, std::min(v1.x, v2.x))));
+        t.maxX = std::min(OCCLUSION_WIDTH - 1, (int)std::ceil(std::max(v0.x, std::max(v1.x, v2.x))));
+        t.minY = std::max(0, (int)std::floor(std::min(v0.y, std::min(v1.y, v2.y))));
+        t.maxY = std::min(OCCLUSION_HEIGHT - 1, (int)std::ceil(std::max(v0.y, std::max(v1.y, v2.y))));
+        if (t.minX > t.maxX || t.minY > t.maxY)
+            return;
+
+        const glm::vec3 v[3] = {v0, v1, v2};
+        for (int k = 0; k < 3; ++k)
+        {
+            const glm::vec3 &p = v[k], &q = v[(k + 1) % 3];
+            t.a[k] = p.y - q.y;
+            t.b[k] = q.x - p.x;
+            t.c[k] = p.x * q.y - p.y * q.x;
+        }
+        // Derinlik düzlemi: ağırlık merkezi koordinatlarından
+        t.zx = ((v1.y - v2.y) * v0.z + (v2.y - v0.y) * v1.z + (v0.y - v1.y) * v2.z) / area;
+        t.zy = ((v2.x - v1.x) * v0.z + (v0.x - v2.x) * v1.z + (v1.x - v0.x) * v2.z) / area;
+        t.z0 = v0.z - t.zx * v0.x - t.zy * v0.y;
+        triangles.push_back(t);
+    }
+
+    // [rowBegin, rowEnd) satırlarına bütün üçgenleri çizer; piksel merkezi
+    // üçgenin içindeyse derinliğin küçüğü yazılır
+    void rasterizeBand(int rowBegin, int rowEnd)
+    {
+        for (const ScreenTriangle &t : triangles)
+        {
+            const int y0 = std::max(t.minY, rowBegin), y1 = std::min(t.maxY, rowEnd - 1);
+            const int x0 = t.minX & ~3; // Dörtlü gruplar hizalı başlar (genişlik 4'ün katı)
+            for (int y = y0; y <= y1; ++y)
+            {
+                float *row = depth.data() + (size_t)y * OCCLUSION_WIDTH;
+                const float py = (float)y + 0.5f;
+                int x = x0;
+#ifdef CULLING_SSE
+                const __m128 offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+                __m128 edgeRow[3], edgeStep[3];
+                for (int k = 0; k < 3; ++k)
+                {
+                    edgeRow[k] = _mm_set1_ps(t.b[k] * py + t.c[k]);
+                    edgeStep[k] = _mm_set1_ps(t.a[k]);
+                }
+                const __m128 depthRow = _mm_set1_ps(t.zy * py + t.z0), depthStep = _mm_set1_ps(t.zx);
+                const __m128 zero = _mm_setzero_ps();
+                for (; x <= t.maxX; x += 4)
+                {
+                    const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), offsets);
+                    __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeStep[0], px), edgeRow[0]), zero);
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeStep[1], px), edgeRow[1]), zero));
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeStep[2], px), edgeRow[2]), zero));
+                    if (!_mm_movemask_ps(inside))
+                        continue;
+                    const __m128 z = _mm_add_ps(_mm_mul_ps(depthStep, px), depthRow);
+                    const __m128 current = _mm_loadu_ps(row + x);
+                    const __m128 nearer = _mm_min_ps(current, z);
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, current)));
+                }
+#else
+                for (; x <= t.maxX; ++x)
+                {
+                    const float px = (float)x + 0.5f;
+                    if (t.a[0] * px + t.b[0] * py + t.c[0] < 0.0f || t.a[1] * px + t.b[1] * py + t.c[1] < 0.0f ||
+                        t.a[2] * px + t.b[2] * py + t.c[2] < 0.0f)
+                        continue;
+                    row[x] = std::min(row[x], t.zx * px + t.zy * py + t.z0);
+                }
+#endif
+            }
+        }
+    }
+
+    std::vector<glm::vec3> occluders;
+    std::vector<ScreenTriangle> triangles;
+    std::vector<float> depth;
+    glm::mat4 viewProjection = glm::mat4(1.0f);
+};
+
+#endif
@@ -0,0 +1,419 @@
+#ifndef STATIC_BATCH_H
+#define STATIC_BATCH_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "box_builder.h"
+#include "cell_portal.h"
+#include "culling.h"
+#include "frustum.h"
+#include "mesh_arena.h"
+#include "mesh_optimize.h"
+#include "mesh_weld.h"
+#include "meshlet.h"
+#include "occlusion_queries.h"
+#include "software_occlusion.h"
+#include "transform_buffer.h"
+
+// Eksen hizalı bir kutu: birim küp model matrisiyle kutuya dönüştürülür; üst,
+// yan ve alt yüzlerin renkleri ayrı tutulur
+struct BoxMeshDesc
+{
+    glm::mat4 model;
+    glm::vec3 topColor;
+    glm::vec3 sideColor;
+    glm::vec3 bottomColor;
+};
+
+// [minCorner, maxCorner] kutusu, isteğe bağlı bir üst dönüşümle
+inline BoxMeshDesc boxMesh(glm::vec3 minCorner, glm::vec3 maxCorner, glm::vec3 topColor, glm::vec3 sideColor,
+                           glm::vec3 bottomColor, const glm::mat4 &parent = glm::mat4(1.0f))
+{
+    BoxMeshDesc box;
+    box.model = glm::translate(parent, (minCorner + maxCorner) * 0.5f);
+    box.model = glm::scale(box.model, maxCorner - minCorner);
+    box.topColor = topColor;
+    box.sideColor = sideColor;
+    box.bottomColor = bottomColor;
+    return box;
+}
+
+// Tek renkli kutu
+inline BoxMeshDesc boxMesh(glm::vec3 minCorner, glm::vec3 maxCorner, glm::vec3 color,
+                           const glm::mat4 &parent = glm::mat4(1.0f))
+{
+    return boxMesh(minCorner, maxCorner, color, color, color, parent);
+}
+
+// Birim küp (-0.5 .. 0.5), 6 yüz x 6 vertex, derleme zamanında üretilir.
+// Vertex rengi yüz seçicidir: (1,0,0) üst, (0,1,0) yan, (0,0,1) alt.
+inline constexpr VertexArray<36> UNIT_CUBE_VERTICES =
+    box({-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+
+// Hiç hareket etmeyen geometriyi yükleme sırasında dünya uzayına "pişirip"
+// (bake) tek bir arena aralığında toplayan yığın. Pozisyonlar model matrisiyle,
+// normaller normal matrisiyle çevrilir; çizimde model matrisi birimdir ve
+// bütün nesneler tek glMultiDrawElementsBaseVertex çağrısıyla gönderilir. Nesne
+// aralıkları ve dünya uzayı sınırları (kutu + küre) ayrı tutulur. addTo() her
+// nesneyi kaynaklayıp vertex önbelleğine göre sıralar ve kümelere (meshlet)
+// böler; cull() her karede önce nesneleri (SoA, SIMD), sonra görünen
+// nesnelerin kümelerini ayıklayıp çağrıdan çıkarır.
+class StaticBatch
+{
+public:
+    // Bir nesnenin yığın içindeki yeri: addTo'dan önce vertex, sonra arenanın
+    // indeks tamponundaki aralığı
+    struct Object
+    {
+        GLint first;
+        GLsizei count;
+        ObjectBounds bounds; // Dünya uzayında
+        size_t firstMeshlet = 0;
+        size_t meshletCount = 0;
+        bool closed = false; // Kapalı yüzey: arka yüzleri görünmez, kümeleri koniyle ayıklanabilir
+    };
+
+    // Son bilinen sorgu sonucu örtülü olduğu için ana çağrıdan ayrılan nesne;
+    // kümeleri deferredFirsts/deferredCounts içinde [firstRange, firstRange + rangeCount)
+    struct DeferredObject
+    {
+        size_t object;
+        size_t firstRange;
+        size_t rangeCount;
+    };
+
+    // 9 float'lık GL_TRIANGLES dizisini model matrisiyle dünya uzayına çevirip
+    // ekler; nesnenin indeksini döndürür. Yüz ayıklama kapalı olduğu için açık
+    // yüzeyler (tek dörtgenler: duvar, taban, monitör) iki yüzlü görünür; sadece
+    // closed verilen (kutu, piramit gibi kapalı) nesnelerin kümeleri normal
+    // konisiyle ayıklanır.
+    size_t add(const float *data, size_t floatCount, const glm::mat4 &model, bool closed = false)
+    {
+        const glm::mat3 normals = normalMatrix(model);
+        Object object;
+        object.closed = closed;
+        object.first = (GLint)(vertices.size() / MeshArena::FLOATS_PER_VERTEX);
+        object.count = (GLsizei)(floatCount / MeshArena::FLOATS_PER_VERTEX);
+
+        for (size_t i = 0; i + MeshArena::FLOATS_PER_VERTEX <= floatCount; i += MeshArena::FLOATS_PER_VERTEX)
+        {
+            const float *v = data + i;
+            glm::vec3 position = glm::vec3(model * glm::vec4(v[0], v[1], v[2], 1.0f));
+            glm::vec3 normal = glm::normalize(normals * glm::vec3(v[3], v[4], v[5]));
+            push(position, normal, glm::vec3(v[6], v[7], v[8]));
+        }
+        object.bounds = computeBounds(vertices.data() + object.first * MeshArena::FLOATS_PER_VERTEX, object.count,
+                                      MeshArena::FLOATS_PER_VERTEX);
+        objects.push_back(object);
+        return objects.size() - 1;
+    }
+
+    template <size_t N>
+    size_t add(const float (&data)[N], const glm::mat4 &model = glm::mat4(1.0f), bool closed = false)
+    {
+        return add(data, N, model, closed);
+    }
+
+    // box_builder.h'nin derleme zamanında ürettiği diziler
+    template <size_t N>
+    size_t add(const std::array<float, N> &data, const glm::mat4 &model = glm::mat4(1.0f), bool closed = false)
+    {
+        return add(data.data(), N, model, closed);
+    }
+
+    // Kutu: birim küp kutunun dönüşümüyle, yüz seçici de kutunun renkleriyle çözülür
+    size_t add(const BoxMeshDesc &box)
+    {
+        std::vector<float> colored(UNIT_CUBE_VERTICES.begin(), UNIT_CUBE_VERTICES.end());
+        const glm::mat3 faceColors(box.topColor, box.sideColor, box.bottomColor);
+        for (size_t i = 0; i < colored.size(); i += MeshArena::FLOATS_PER_VERTEX)
+        {
+            glm::vec3 color = faceColors * glm::vec3(colored[i + 6], colored[i + 7], colored[i + 8]);
+            colored[i + 6] = color.r;
+            colored[i + 7] = color.g;
+            colored[i + 8] = color.b;
+        }
+        return add(colored.data(), colored.size(), box.model, true);
+    }
+
+    // Nesnenin dünya uzayı üçgenleri yazılım örtme tamponuna çizilir (büyük,
+    // kapalı yüzeyler: duvarlar, taban, masa); addTo()'dan önce çağrılmalı.
+    // Üçgenler vertex normallerine göre saat yönü tersine çevrilir: kümeler
+    // de ön yüzü normallerden alır (meshlet.h), arkasını dönen örtücü çizilmez.
+    void setOccluder(size_t object)
+    {
+        const Object &o = objects[object];
+        for (GLsizei i = 0; i + 2 < o.count; i += 3)
+        {
+            const float *v = vertices.data() + (o.first + i) * MeshArena::FLOATS_PER_VERTEX;
+            const size_t stride = MeshArena::FLOATS_PER_VERTEX;
+            const glm::vec3 a(v[0], v[1], v[2]);
+            glm::vec3 b(v[stride], v[stride + 1], v[stride + 2]), c(v[2 * stride], v[2 * stride + 1], v[2 * stride + 2]);
+            const glm::vec3 normal = glm::vec3(v[3], v[4], v[5]) + glm::vec3(v[stride + 3], v[stride + 4], v[stride + 5]) +
+                                     glm::vec3(v[2 * stride + 3], v[2 * stride + 4], v[2 * stride + 5]);
+            if (glm::dot(glm::cross(b - a, c - a), normal) < 0.0f)
+                std::swap(b, c);
+            occluders.insert(occluders.end(), {a, b, c});
+        }
+    }
+
+    // Nesneleri sınır kutularının merkezine göre hücrelere dağıtır; cull()'a
+    // portals verildiğinde sadece ulaşılan hücrelerin nesneleri gezilir
+    void assignCells(const CellPortalGraph &portals)
+    {
+        cellObjects.assign(portals.cellCount(), std::vector<size_t>());
+        uncelledObjects.clear();
+        for (size_t o = 0; o < objects.size(); ++o)
+        {
+            const size_t cell = portals.cellAt(objects[o].bounds.center);
+            if (cell == PORTAL_NO_CELL)
+                uncelledObjects.push_back(o);
+            else
+                cellObjects[cell].push_back(o);
+        }
+    }
+
+    // Örtücü üçgenlerin köşeleri (üçer üçer)
+    const std::vector<glm::vec3> &occluderTriangles() const
+    {
+        return occluders;
+    }
+
+    // Pişmiş geometriyi arenaya tek indeksli aralık olarak ekler; arenanın
+    // upload()'undan önce çağrılmalı. Her nesne kaynaklanır, optimizeMesh ile
+    // vertex önbelleğine göre sıralanır ve üçgenleri kümelere göre yeniden
+    // dizilir (kümeler indeks dizisinde ardışık aralıklardır). CPU kopyası burada bırakılır.
+    MeshRange addTo(MeshArena &arena)
+    {
+        WeldedMesh batch;
+        meshlets.clear();
+        culling.clear();
+        cacheStats = MeshOptimizeStats();
+        size_t inputVertices = 0, removedVertices = 0;
+        for (Object &object : objects)
+        {
+            culling.add(object.bounds);
+            object.firstMeshlet = meshlets.size();
+            WeldedMesh mesh = weldVertices(vertices.data() + object.first * MeshArena::FLOATS_PER_VERTEX, object.count);
+            inputVertices += object.count;
+            removedVertices += mesh.removedVertices;
+            const size_t vertexCount = optimizeMesh(mesh.vertices.data(), mesh.vertices.size() / MeshArena::FLOATS_PER_VERTEX,
+                                                    mesh.indices.data(), mesh.indices.size(), &cacheStats);
+            mesh.vertices.resize(vertexCount * MeshArena::FLOATS_PER_VERTEX);
+
+            const uint32_t baseVertex = (uint32_t)(batch.vertices.size() / MeshArena::FLOATS_PER_VERTEX);
+            object.first = (GLint)batch.indices.size();
+            object.count = (GLsizei)mesh.indices.size();
+            for (Meshlet meshlet : buildMeshlets(mesh.vertices.data(), vertexCount, mesh.indices.data(), mesh.indices.size()))
+            {
+                meshlet.firstIndex += object.first;
+                if (!object.closed)
+                    meshlet.bounds.coneCutoff = 1.0f; // İki yüzlü: koni testi yok
+                meshlets.push_back(meshlet);
+            }
+            object.meshletCount = meshlets.size() - object.firstMeshlet;
+            batch.vertices.insert(batch.vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+            for (uint32_t index : mesh.indices)
+                batch.indices.push_back(baseVertex + index);
+        }
+
+        range = arena.addIndexed(batch);
+        this->arena = &arena;
+        for (Object &object : objects)
+            object.first += range.firstIndex;
+        for (Meshlet &meshlet : meshlets)
+            meshlet.firstIndex += range.firstIndex;
+        std::cout << "Statik yığın: " << objects.size() << " nesne, " << meshlets.size() << " küme, "
+                  << range.vertexCount << " vertex, " << range.indexCount << " indeks tek çizim çağrısında" << std::endl;
+        std::cout << "Kaynak: " << inputVertices << " -> " << inputVertices - removedVertices << " vertex ("
+                  << removedVertices << " silindi)" << std::endl;
+        cacheStats.print(std::cout);
+
+        // Ayıklama yapılmadan da çizilebilsin
+        firsts.clear();
+        counts.clear();
+        for (const Object &object : objects)
+        {
+            firsts.push_back(object.first);
+            counts.push_back(object.count);
+        }
+
+        std::vector<float>().swap(vertices);
+        return range;
+    }
+
+    // Çizim listesini kurar: önce bütün nesneler görüş hacmine karşı dörder
+    // dörder test edilir, occlusion verildiyse kalanların sınır kutuları bu
+    // karenin örtme tamponuna karşı test edilir; sonra görünen nesnelerin
+    // kümelerinden kameraya arkasını dönenler ya da görüş hacminin dışında
+    // kalanlar atılır. Art arda görünen kümeler tek aralıkta birleşir.
+    // queries verildiyse son sorgu sonucu örtülü olan nesneler ana çağrıya
+    // girmez, deferredObjects() listesinde koşullu çizimi bekler. portals
+    // verildiyse ve kamera bir hücredeyse (assignCells sonrası) görüş hacmi
+    // testi yerine sadece ulaşılan hücrelerin nesneleri portal hacimlerine
+    // karşı test edilir.
+    void cull(const Frustum &frustum, const glm::vec3 &cameraPos, const SoftwareOcclusion *occlusion = nullptr,
+              const OcclusionQueries *queries = nullptr, const CellPortalGraph *portals = nullptr)
+    {
+        candidates.clear();
+        if (portals && portals->active() && cellObjects.size() == portals->cellCount())
+        {
+            for (size_t cell : portals->visibleCells())
+            {
+                for (size_t o : cellObjects[cell])
+                {
+                    if (portals->visible(cell, objects[o].bounds.boundsMin, objects[o].bounds.boundsMax))
+                        candidates.push_back(o);
+                }
+            }
+            for (size_t o : uncelledObjects)
+            {
+                if (aabbInFrustum(frustum, objects[o].bounds.boundsMin, objects[o].bounds.boundsMax))
+                    candidates.push_back(o);
+            }
+            std::sort(candidates.begin(), candidates.end()); // Çizim sırası eklenme sırası kalsın
+        }
+        else
+        {
+            culling.cull(frustum, objectVisible);
+            for (size_t o = 0; o < objects.size(); ++o)
+            {
+                if (objectVisible[o])
+                    candidates.push_back(o);
+            }
+        }
+
+        firsts.clear();
+        counts.clear();
+        deferredFirsts.clear();
+        deferredCounts.clear();
+        drawn.clear();
+        deferred.clear();
+        stats = CullStats();
+        stats.objects = objects.size();
+        stats.clusters = meshlets.size();
+        for (size_t o : candidates)
+        {
+            const Object &object = objects[o];
+            if (occlusion && !occlusion->visible(object.bounds.boundsMin, object.bounds.boundsMax))
+            {
+                ++stats.occludedObjects;
+                continue;
+            }
+            ++stats.visibleObjects;
+            if (queries && !queries->visible(o))
+            {
+                DeferredObject d;
+                d.object = o;
+                d.firstRange = deferredFirsts.size();
+                appendMeshlets(object, frustum, cameraPos, deferredFirsts, deferredCounts);
+                d.rangeCount = deferredFirsts.size() - d.firstRange;
+                if (d.rangeCount > 0)
+                    deferred.push_back(d);
+                continue;
+            }
+            drawn.push_back(o);
+            appendMeshlets(object, frustum, cameraPos, firsts, counts);
+        }
+    }
+
+    // Arenanın VAO'su bağlı olmalı
+    void draw() const
+    {
+        if (!firsts.empty())
+            arena->multiDraw(range, firsts.data(), counts.data(), (GLsizei)firsts.size());
+    }
+
+    // Ayrılan nesnenin kümeleri; arenanın VAO'su bağlı olmalı
+    void drawDeferred(const DeferredObject &d) const
+    {
+        arena->multiDraw(range, deferredFirsts.data() + d.firstRange, deferredCounts.data() + d.firstRange,
+                         (GLsizei)d.rangeCount);
+    }
+
+    // Son cull()'da ana çağrıya giren nesneler
+    const std::vector<size_t> &drawnObjects() const
+    {
+        return drawn;
+    }
+
+    const std::vector<DeferredObject> &deferredObjects() const
+    {
+        return deferred;
+    }
+
+    const CullStats &cullStats() const
+    {
+        return stats;
+    }
+
+    const std::vector<Object> &objectList() const
+    {
+        return objects;
+    }
+
+    // Pişmiş vertexler; addTo() çağrılana kadar geçerli
+    const std::vector<float> &vertexData() const
+    {
+        return vertices;
+    }
+
+private:
+    // Nesnenin görünen kümelerini aralık listesine ekler; ardışık olanlar birleşir
+    void appendMeshlets(const Object &object, const Frustum &frustum, const glm::vec3 &cameraPos,
+                        std::vector<GLint> &rangeFirsts, std::vector<GLsizei> &rangeCounts)
+    {
+        for (size_t m = object.firstMeshlet; m < object.firstMeshlet + object.meshletCount; ++m)
+        {
+            const Meshlet &meshlet = meshlets[m];
+            if (!meshletVisible(meshlet.bounds, glm::mat4(1.0f), cameraPos, frustum))
+                continue;
+            ++stats.visibleClusters;
+            const GLint first = (GLint)meshlet.firstIndex;
+            const GLsizei count = (GLsizei)(meshlet.triangleCount * 3);
+            if (!rangeFirsts.empty() && rangeFirsts.back() + rangeCounts.back() == first)
+                rangeCounts.back() += count;
+            else
+            {
+                rangeFirsts.push_back(first);
+                rangeCounts.push_back(count);
+            }
+        }
+    }
+
+    void push(const glm::vec3 &position, const glm::vec3 &normal, const glm::vec3 &color)
+    {
+        const float v[9] = {position.x, position.y, position.z, normal.x, normal.y, normal.z, color.r, color.g, color.b};
+        vertices.insert(vertices.end(), v, v + 9);
+    }
+
+    std::vector<float> vertices;
+    std::vector<Object> objects;
+    std::vector<glm::vec3> occluders;
+    std::vector<Meshlet> meshlets; // Dünya uzayında; firstIndex arenanın indeks tamponunda
+    CullingSet culling;            // Nesne sınırları, objects ile aynı sırada
+    std::vector<uint8_t> objectVisible;
+    std::vector<std::vector<size_t>> cellObjects; // assignCells(); hücre başına nesneler
+    std::vector<size_t> uncelledObjects;
+    std::vector<size_t> candidates; // Görüş hacmi ya da portal testinden geçenler
+    CullStats stats;
+    MeshOptimizeStats cacheStats; // addTo()'daki sıralamanın önbellek simülasyonu
+    const MeshArena *arena = nullptr;
+    MeshRange range; // Arenadaki indeksli aralık
+    std::vector<GLint> firsts;
+    std::vector<GLsizei> counts;
+    std::vector<GLint> deferredFirsts;
+    std::vector<GLsizei> deferredCounts;
+    std::vector<size_t> drawn;
+    std::vector<DeferredObject> deferred;
+};
+
+#endif
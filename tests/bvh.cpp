@@ -0,0 +1,194 @@
+// Bvh sorguları kaba kuvvetle aynı sonucu vermeli: cull() her nesneyi tek tek
+// kutu + küre testiyle ayıklamakla, raycast() en yakın kutuyu aramakla,
+// overlap() bütün kutuları kesişim için denemekle. Nesneler update() + refit()
+// ile (kısmi yeniden kurmayı tetikleyecek kadar) taşındıktan sonra da aynı
+// kontroller yapılır ve her düğümün çocuklarını kapsadığı doğrulanır.
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../bvh.h"
+#include "../culling.h"
+#include "../frustum.h"
+
+static int failures = 0;
+
+static void expect(bool condition, const char *name, const char *what)
+{
+    if (!condition)
+    {
+        std::cerr << "  " << name << ": " << what << std::endl;
+        ++failures;
+    }
+}
+
+static bool contains(const glm::vec3 &outerMin, const glm::vec3 &outerMax, const glm::vec3 &innerMin,
+                     const glm::vec3 &innerMax)
+{
+    return glm::all(glm::lessThanEqual(outerMin, innerMin)) && glm::all(glm::greaterThanEqual(outerMax, innerMax));
+}
+
+// Kökten gezer: iç düğüm iki çocuğunu, yaprak nesnelerini kapsamalı; her
+// nesne tam bir yaprakta bulunmalı
+static void checkTree(const char *name, const Bvh &bvh)
+{
+    std::vector<int> seen(bvh.itemCount(), 0);
+    bool containsAll = true;
+    std::vector<uint32_t> stack(1, 0);
+    while (!stack.empty())
+    {
+        const BvhNode &node = bvh.node(stack.back());
+        stack.pop_back();
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                const ObjectBounds &item = bvh.itemBounds(bvh.leafItem(i));
+                containsAll &= contains(node.boundsMin, node.boundsMax, item.boundsMin, item.boundsMax);
+                ++seen[bvh.leafItem(i)];
+            }
+            continue;
+        }
+        for (uint32_t child = node.first; child < node.first + 2; ++child)
+        {
+            containsAll &= contains(node.boundsMin, node.boundsMax, bvh.node(child).boundsMin, bvh.node(child).boundsMax);
+            stack.push_back(child);
+        }
+    }
+    expect(containsAll, name, "bir düğüm çocuğunu kapsamıyor");
+    expect(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }), name,
+           "her nesne tam bir yaprakta olmalı");
+}
+
+// Bvh::rayBox ile aynı slab testi
+static bool rayBox(const glm::vec3 &origin, const glm::vec3 &inverse, const ObjectBounds &bounds, float &entry)
+{
+    const glm::vec3 t0 = (bounds.boundsMin - origin) * inverse;
+    const glm::vec3 t1 = (bounds.boundsMax - origin) * inverse;
+    const glm::vec3 tMin = glm::min(t0, t1), tMax = glm::max(t0, t1);
+    entry = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+    const float exit = std::min(std::min(tMax.x, tMax.y), tMax.z);
+    return entry <= exit;
+}
+
+static bool boxesOverlap(const ObjectBounds &a, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+{
+    return glm::all(glm::lessThanEqual(a.boundsMin, boundsMax)) && glm::all(glm::greaterThanEqual(a.boundsMax, boundsMin));
+}
+
+int main()
+{
+    std::mt19937 random(4321);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    auto vec = [&]() { return glm::vec3(unit(random), unit(random), unit(random)); };
+    auto randomBox = [&](const glm::vec3 &center, float size)
+    {
+        const glm::vec3 extent = (glm::abs(vec()) + 0.05f) * size;
+        return boxBounds(center - extent, center + extent);
+    };
+
+    size_t culled = 0, rays = 0, overlaps = 0;
+    // Sorguların hepsini kaba kuvvetle karşılaştırır
+    auto checkQueries = [&](const char *name, const Bvh &bvh, const std::vector<ObjectBounds> &items)
+    {
+        checkTree(name, bvh);
+        for (int q = 0; q < 20; ++q)
+        {
+            const glm::vec3 eye = vec() * 40.0f;
+            const glm::mat4 view = glm::lookAt(eye, eye + vec(), glm::vec3(0.0f, 1.0f, 0.0f));
+            const glm::mat4 projection = glm::perspective(glm::radians(40.0f + 40.0f * (unit(random) * 0.5f + 0.5f)),
+                                                          1.5f, 0.1f, 20.0f + 40.0f * (unit(random) + 1.0f));
+            const Frustum frustum = extractFrustum(projection * view);
+            std::vector<uint32_t> found, expected;
+            bvh.cull(frustum, [&](uint32_t item) { found.push_back(item); });
+            for (uint32_t i = 0; i < (uint32_t)items.size(); ++i)
+            {
+                if (aabbInFrustum(frustum, items[i].boundsMin, items[i].boundsMax) &&
+                    sphereInFrustum(frustum, items[i].center, items[i].radius))
+                    expected.push_back(i);
+            }
+            std::sort(found.begin(), found.end());
+            expect(found == expected, name, "cull kaba kuvvetten farklı");
+            culled += expected.size();
+
+            const glm::vec3 direction = glm::normalize(vec());
+            uint32_t hitItem;
+            float hitDistance;
+            const bool hit = bvh.raycast(eye, direction, hitItem, hitDistance);
+            float nearest = std::numeric_limits<float>::max();
+            for (const ObjectBounds &item : items)
+            {
+                float entry;
+                if (rayBox(eye, 1.0f / direction, item, entry))
+                    nearest = std::min(nearest, entry);
+            }
+            const bool expectedHit = nearest != std::numeric_limits<float>::max();
+            expect(hit == expectedHit, name, "raycast isabeti kaba kuvvetten farklı");
+            if (hit && expectedHit)
+            {
+                float entry;
+                expect(hitDistance == nearest, name, "raycast uzaklığı kaba kuvvetten farklı");
+                expect(rayBox(eye, 1.0f / direction, items[hitItem], entry) && entry == hitDistance, name,
+                       "raycast'in döndürdüğü nesne o uzaklıkta değil");
+                ++rays;
+            }
+
+            const ObjectBounds region = randomBox(vec() * 40.0f, 8.0f);
+            found.clear();
+            expected.clear();
+            bvh.overlap(region.boundsMin, region.boundsMax, [&](uint32_t item) { found.push_back(item); });
+            for (uint32_t i = 0; i < (uint32_t)items.size(); ++i)
+            {
+                if (boxesOverlap(items[i], region.boundsMin, region.boundsMax))
+                    expected.push_back(i);
+            }
+            std::sort(found.begin(), found.end());
+            expect(found == expected, name, "overlap kaba kuvvetten farklı");
+            overlaps += expected.size();
+        }
+    };
+
+    size_t partialRebuilds = 0;
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        const size_t itemCount = 1 + trial * 37 % 500;
+        std::vector<ObjectBounds> items;
+        for (size_t i = 0; i < itemCount; ++i)
+            items.push_back(randomBox(vec() * 50.0f, 2.0f));
+        Bvh bvh;
+        bvh.build(items);
+        checkQueries("build", bvh, items);
+
+        // Her adımda nesnelerin bir kısmı biraz, birkaçı çok uzağa taşınır;
+        // uzağa gidenler alt ağaçları bozup kısmi yeniden kurmayı tetikler
+        for (int step = 0; step < 5; ++step)
+        {
+            for (uint32_t i = 0; i < (uint32_t)itemCount; ++i)
+            {
+                if (random() % 4 != 0)
+                    continue;
+                const glm::vec3 center = items[i].center + vec() * (random() % 8 == 0 ? 60.0f : 2.0f);
+                items[i] = randomBox(glm::clamp(center, glm::vec3(-60.0f), glm::vec3(60.0f)), 2.0f);
+                bvh.update(i, items[i]);
+            }
+            bvh.refit();
+            checkQueries("refit", bvh, items);
+        }
+        partialRebuilds += bvh.partialRebuildCount();
+    }
+    expect(partialRebuilds > 0, "refit", "kısmi yeniden kurma hiç denenmedi");
+
+    std::cout << "bvh: " << culled << " görünür, " << rays << " ışın isabeti, " << overlaps << " kesişim, "
+              << partialRebuilds << " kısmi yeniden kurma" << std::endl;
+    if (failures)
+    {
+        std::cerr << "ERROR::TEST::BVH " << failures << " kontrol başarısız" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+// CullingSet'in SSE ve skaler yolları rastgele kutularda ve rastgele görüş
+// hacimlerinde aynı görünürlüğü vermeli. Kutuların bir kısmı bilerek bir
+// düzleme teğet konur; toplama sırası farkı en çok orada ortaya çıkar.
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../culling.h"
+#include "../frustum.h"
+
+int main()
+{
+#ifndef CULLING_SSE
+    std::cout << "culling_simd: SSE yok, cull() zaten skaler yolu kullanıyor" << std::endl;
+#endif
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    auto vec = [&]() { return glm::vec3(unit(random), unit(random), unit(random)); };
+
+    size_t tested = 0, visibleCount = 0, mismatches = 0;
+    for (int trial = 0; trial < 200; ++trial)
+    {
+        const glm::vec3 eye = vec() * 10.0f;
+        const glm::mat4 view = glm::lookAt(eye, eye + vec(), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::mat4 projection = glm::perspective(glm::radians(30.0f + 60.0f * (unit(random) * 0.5f + 0.5f)),
+                                                      1.0f + unit(random) * 0.5f, 0.1f, 5.0f + 20.0f * (unit(random) + 1.0f));
+        const Frustum frustum = extractFrustum(projection * view);
+
+        // 4'ün katı olmayan sayı: son SIMD grubunun dolgusu da denenir
+        const size_t objectCount = 1 + trial * 7 % 301;
+        CullingSet set;
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            glm::vec3 center = eye + vec() * 30.0f;
+            const glm::vec3 extent = glm::abs(vec()) * 2.0f;
+            if (i % 3 == 0)
+            {
+                // Kutuyu bir düzleme teğet kaydır
+                const glm::vec4 &plane = frustum.planes[i % 6];
+                const glm::vec3 normal(plane);
+                const float distance = glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extent);
+                center -= normal * distance;
+            }
+            set.add(boxBounds(center - extent, center + extent));
+        }
+
+        std::vector<uint8_t> simd, scalar;
+        set.cull(frustum, simd);
+        set.cullScalar(frustum, scalar);
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            if (simd[i] != scalar[i])
+                ++mismatches;
+            visibleCount += scalar[i];
+        }
+        tested += objectCount;
+    }
+
+    std::cout << "culling_simd: " << tested << " kutu, " << visibleCount << " görünür, " << mismatches << " uyuşmazlık"
+              << std::endl;
+    if (mismatches)
+    {
+        std::cerr << "ERROR::TEST::CULLING_SIMD SSE ve skaler yol farklı sonuç verdi" << std::endl;
+        return 1;
+    }
+    return 0;
+}
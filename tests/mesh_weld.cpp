@@ -0,0 +1,114 @@
+// weldVertices gidiş-dönüş kontrolü: kaynaklanmış vertexler indekslerle geri
+// açılınca girdi üçgen dizisi aynen (yalnız -0.0 / 0.0 farkı hariç) çıkmalı,
+// çıktıda iki aynı vertex kalmamalı. toTriangleList'in fan / şerit açılımı da
+// aynı yoldan sınanır.
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include "../box_builder.h"
+#include "../mesh_weld.h"
+#include "../procedural_mesh.h"
+
+static int failures = 0;
+
+static void expect(bool condition, const char *name, const char *what)
+{
+    if (!condition)
+    {
+        std::cerr << "  " << name << ": " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Kaynaklar, geri açar ve girdiyle karşılaştırır; tekrarsız vertex sayısını döndürür
+static size_t roundTrip(const char *name, const std::vector<float> &soup)
+{
+    const size_t vertexCount = soup.size() / 9;
+    const WeldedMesh mesh = weldVertices(soup.data(), vertexCount);
+    const size_t unique = mesh.vertices.size() / 9;
+
+    expect(mesh.indices.size() == vertexCount, name, "her girdi vertexi için bir indeks olmalı");
+    expect(mesh.removedVertices == vertexCount - unique, name, "removedVertices tutarsız");
+
+    bool same = true;
+    for (size_t i = 0; i < mesh.indices.size() && same; ++i)
+    {
+        expect(mesh.indices[i] < unique, name, "indeks aralık dışında");
+        for (int k = 0; k < 9; ++k)
+            same = same && mesh.vertices[mesh.indices[i] * 9 + k] == soup[i * 9 + k];
+    }
+    expect(same, name, "geri açılan üçgenler girdiden farklı");
+
+    std::set<std::vector<float>> distinct;
+    for (size_t v = 0; v < unique; ++v)
+    {
+        std::vector<float> vertex(mesh.vertices.begin() + v * 9, mesh.vertices.begin() + v * 9 + 9);
+        for (float &f : vertex)
+            f += 0.0f;
+        distinct.insert(vertex);
+    }
+    expect(distinct.size() == unique, name, "çıktıda aynı vertex iki kez var");
+
+    std::cout << name << ": " << vertexCount << " -> " << unique << " vertex" << std::endl;
+    return unique;
+}
+
+int main()
+{
+    // Kutu: köşe başına 3 yüz, her yüzün normali ayrı; 24 vertex kalır
+    static constexpr auto boxVertices = box({0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}, {1.0f, 0.0f, 0.0f},
+                                            {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+    expect(roundTrip("kutu", std::vector<float>(boxVertices.begin(), boxVertices.end())) == 24, "kutu",
+           "24 vertex beklenirdi");
+
+    // -0.0 ile 0.0 aynı vertex: dörtgenin iki köşesi işaretli sıfırla yazılır
+    static constexpr auto quadVertices = quad({0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f},
+                                              {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f});
+    std::vector<float> signedZero(quadVertices.begin(), quadVertices.end());
+    signedZero[5 * 9 + 0] = -0.0f; // Son vertex (a) ilk vertexin kopyası
+    signedZero[5 * 9 + 4] = -0.0f;
+    expect(roundTrip("işaretli sıfır", signedZero) == 4, "işaretli sıfır", "-0.0 ayrı vertex sayıldı");
+
+    // İndeksli prosedürel küre üçgen dizisine açılıp yeniden kaynaklanır:
+    // dikiş vertexleri de birleşebilir, sayı üretilenden fazla olamaz
+    std::vector<float> sphereVertices;
+    std::vector<uint32_t> sphereIndices;
+    generateProceduralMesh(sphereMesh(0.5f, 24, 12, glm::vec3(0.2f, 0.4f, 0.6f)), sphereVertices, sphereIndices);
+    std::vector<float> sphereSoup;
+    for (uint32_t index : sphereIndices)
+        sphereSoup.insert(sphereSoup.end(), &sphereVertices[index * 9], &sphereVertices[index * 9] + 9);
+    expect(roundTrip("küre 24x12", sphereSoup) <= sphereVertices.size() / 9, "küre 24x12",
+           "üretilenden fazla vertex kaldı");
+
+    // Şerit ve fan: açılan listeler kaynaklanınca girdi vertex sayısına döner
+    std::vector<float> strip;
+    for (int i = 0; i < 6; ++i)
+    {
+        const float v[9] = {(float)(i / 2), (float)(i % 2), 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+        strip.insert(strip.end(), v, v + 9);
+    }
+    const std::vector<float> stripList = toTriangleList(strip.data(), 6, GL_TRIANGLE_STRIP);
+    expect(stripList.size() == 4 * 3 * 9, "şerit", "4 üçgen beklenirdi");
+    expect(roundTrip("şerit", stripList) == 6, "şerit", "6 vertex beklenirdi");
+    // Şeritteki bütün üçgenler aynı yöne sarılmalı (hepsi +z ya da hepsi -z)
+    int positive = 0;
+    for (size_t t = 0; t < stripList.size() / 27; ++t)
+    {
+        const float *p = &stripList[t * 27];
+        const glm::vec3 a(p[0], p[1], p[2]), b(p[9], p[10], p[11]), c(p[18], p[19], p[20]);
+        positive += glm::cross(b - a, c - a).z > 0.0f;
+    }
+    expect(positive == 0 || positive == 4, "şerit", "sarma yönü değişti");
+    const std::vector<float> fanList = toTriangleList(strip.data(), 6, GL_TRIANGLE_FAN);
+    expect(roundTrip("fan", fanList) == 6, "fan", "6 vertex beklenirdi");
+
+    if (failures)
+    {
+        std::cerr << "ERROR::TEST::MESH_WELD " << failures << " kontrol başarısız" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/bin/sh
+# tests/ altındaki bağımsız kontrolleri derleyip çalıştırır. GL bağlamı ya da
+# pencere gerekmez; yalnız başlıklar (glm, GL/glew.h tipleri) kullanılır.
+# Herhangi bir dizinden çalıştırılabilir, CXX ile derleyici seçilebilir.
+set -e
+cd "$(dirname "$0")/.."
+CXX=${CXX:-g++}
+mkdir -p tests/bin
+
+failed=0
+for source in tests/*.cpp; do
+    name=$(basename "$source" .cpp)
+    "$CXX" -std=c++17 -O2 -Wall -Wextra -I./dependencies/include "$source" -o "tests/bin/$name" -pthread
+    if ! "./tests/bin/$name"; then
+        echo "FAILED: $name" >&2
+        failed=1
+    fi
+done
+exit $failed
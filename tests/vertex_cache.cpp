@@ -0,0 +1,100 @@
+// optimizeMesh'in ACMR kazancını analyzeVertexCache ile ölçer: prosedürel
+// meshler hem üretildiği sırayla hem üçgenleri karıştırılmış olarak sıralanır.
+// Önbellek sıralaması ACMR'yi kötüleştirmemeli, overdraw aşaması en fazla
+// eşiği (%5) kadar geri vermeli ve üçgenler (sarma yönleriyle) aynı kalmalı.
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../mesh_optimize.h"
+#include "../procedural_mesh.h"
+
+// Üçgenin vertex verisi, en küçük vertexten başlayacak şekilde döndürülmüş
+// (döndürme sarma yönünü değiştirmez)
+typedef std::array<float, 27> TriangleKey;
+
+static std::vector<TriangleKey> triangleKeys(const std::vector<float> &vertices, const std::vector<uint32_t> &indices)
+{
+    std::vector<TriangleKey> keys;
+    for (size_t t = 0; t < indices.size() / 3; ++t)
+    {
+        std::array<std::array<float, 9>, 3> corners;
+        for (int k = 0; k < 3; ++k)
+            std::copy(&vertices[indices[t * 3 + k] * 9], &vertices[indices[t * 3 + k] * 9] + 9, corners[k].begin());
+        const int first = (int)(std::min_element(corners.begin(), corners.end()) - corners.begin());
+        TriangleKey key;
+        for (int k = 0; k < 3; ++k)
+            std::copy(corners[(first + k) % 3].begin(), corners[(first + k) % 3].end(), key.begin() + k * 9);
+        keys.push_back(key);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+int main()
+{
+    const ProceduralMeshDesc meshes[] = {
+        sphereMesh(0.5f, 32, 16, glm::vec3(1.0f)),
+        sphereMesh(0.5f, 96, 48, glm::vec3(1.0f)),
+        torusMesh(0.5f, 0.15f, 48, 24, glm::vec3(1.0f)),
+        cylinderMesh(0.3f, 1.0f, 64, glm::vec3(1.0f)),
+    };
+    const char *names[] = {"küre 32x16", "küre 96x48", "torus 48x24", "silindir 64"};
+
+    std::mt19937 random(42);
+    int failures = 0;
+    for (size_t m = 0; m < sizeof(meshes) / sizeof(meshes[0]); ++m)
+    {
+        for (int shuffled = 0; shuffled < 2; ++shuffled)
+        {
+            std::vector<float> vertices;
+            std::vector<uint32_t> indices;
+            generateProceduralMesh(meshes[m], vertices, indices);
+            if (shuffled)
+            {
+                std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+                for (size_t t = 0; t < triangles.size(); ++t)
+                    triangles[t] = {indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2]};
+                std::shuffle(triangles.begin(), triangles.end(), random);
+                for (size_t t = 0; t < triangles.size(); ++t)
+                    std::copy(triangles[t].begin(), triangles[t].end(), indices.begin() + t * 3);
+            }
+            const std::vector<TriangleKey> before = triangleKeys(vertices, indices);
+
+            MeshOptimizeStats stats;
+            const size_t vertexCount = optimizeMesh(vertices.data(), vertices.size() / 9, indices.data(), indices.size(), &stats);
+            vertices.resize(vertexCount * 9);
+            const VertexCacheStats lru = analyzeVertexCache(indices.data(), indices.size(), vertexCount, VERTEX_CACHE_LRU);
+
+            std::cout << names[m] << (shuffled ? " (karışık)" : " (üretim sırası)") << ": " << stats.input.triangles
+                      << " üçgen, ACMR " << stats.input.acmr() << " -> " << stats.vertexCache.acmr() << " -> "
+                      << stats.overdraw.acmr() << " (overdraw), LRU " << lru.acmr() << ", ATVR " << stats.overdraw.atvr()
+                      << std::endl;
+
+            bool ok = true;
+            if (stats.vertexCache.acmr() > stats.input.acmr())
+                ok = false, std::cerr << "  önbellek sıralaması ACMR'yi kötüleştirdi" << std::endl;
+            if (stats.overdraw.acmr() > stats.vertexCache.acmr() * 1.05f + 1e-4f)
+                ok = false, std::cerr << "  overdraw aşaması eşikten fazla ACMR kaybettirdi" << std::endl;
+            if (stats.overdraw.acmr() < 0.5f || stats.overdraw.triangles != before.size())
+                ok = false, std::cerr << "  simülasyon sonucu tutarsız" << std::endl;
+            if (shuffled && stats.vertexCache.acmr() > 0.8f * stats.input.acmr())
+                ok = false, std::cerr << "  karışık girdide kazanç beklenenden az" << std::endl;
+            if (triangleKeys(vertices, indices) != before)
+                ok = false, std::cerr << "  üçgenler ya da sarma yönleri değişti" << std::endl;
+            if (!ok)
+                ++failures;
+        }
+    }
+
+    if (failures)
+    {
+        std::cerr << "ERROR::TEST::VERTEX_CACHE " << failures << " mesh başarısız" << std::endl;
+        return 1;
+    }
+    return 0;
+}
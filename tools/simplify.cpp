@@ -0,0 +1,101 @@
+// mesh_simplify.h için çevrimdışı sürücü: prosedürel küre, torus ve kutu
+// üzerinde DEFAULT_LOD_RATIOS seviyelerini üretir, her seviyenin üçgen /
+// vertex sayısını, hatasını ve 1 piksel hataya indiği uzaklığı yazar.
+// buildLodChains bir kez tek iş parçacığıyla, bir kez N iş parçacığıyla
+// çalıştırılır; çıktılar bit bit aynı olmalı, süreler karşılaştırılır.
+//
+//   g++ -std=c++17 -O2 -I./dependencies/include tools/simplify.cpp -o simplify -pthread
+//   ./simplify [N]
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "../box_builder.h"
+#include "../lod.h"
+#include "../mesh_simplify.h"
+#include "../mesh_weld.h"
+#include "../parallel.h"
+#include "../procedural_mesh.h"
+
+// Sahnedeki gibi: indeksli mesh üçgen dizisine açılıp yeniden kaynaklanır
+// (dikişteki aynı vertexler birleşir)
+static WeldedMesh weldProcedural(const ProceduralMeshDesc &desc)
+{
+    std::vector<float> vertices, soup;
+    std::vector<uint32_t> indices;
+    generateProceduralMesh(desc, vertices, indices);
+    for (uint32_t index : indices)
+        soup.insert(soup.end(), &vertices[index * 9], &vertices[index * 9] + 9);
+    return weldVertices(soup.data(), soup.size() / 9);
+}
+
+static bool sameLod(const MeshLod &a, const MeshLod &b)
+{
+    return a.error == b.error && a.mesh.vertices.size() == b.mesh.vertices.size() && a.mesh.indices == b.mesh.indices &&
+           std::memcmp(a.mesh.vertices.data(), b.mesh.vertices.data(), a.mesh.vertices.size() * sizeof(float)) == 0;
+}
+
+static double buildSeconds(const std::vector<WeldedMesh> &meshes, unsigned workers, std::vector<std::vector<MeshLod>> &chains)
+{
+    const auto start = std::chrono::steady_clock::now();
+    chains = buildLodChains(meshes, DEFAULT_LOD_RATIOS, sizeof(DEFAULT_LOD_RATIOS) / sizeof(float), workers);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    // Tek çekirdekli makinede de iş parçacıklı yol denensin diye en az 4
+    const unsigned workers = argc > 1 ? (unsigned)std::max(1, std::atoi(argv[1])) : std::max(workerCount(), 4u);
+
+    static constexpr auto boxVertices = box({-0.5f, 0.0f, -0.5f}, {0.5f, 1.0f, 0.5f}, {0.8f, 0.8f, 0.8f},
+                                            {0.6f, 0.6f, 0.6f}, {0.4f, 0.4f, 0.4f});
+    const char *names[] = {"küre 128x64", "torus 128x48", "kutu"};
+    std::vector<WeldedMesh> meshes = {
+        weldProcedural(sphereMesh(0.5f, 128, 64, glm::vec3(1.0f))),
+        weldProcedural(torusMesh(0.5f, 0.15f, 128, 48, glm::vec3(1.0f))),
+        weldVertices(boxVertices.data(), vertexCount(boxVertices)),
+    };
+
+    std::vector<std::vector<MeshLod>> serial, parallel;
+    const double serialSeconds = buildSeconds(meshes, 1, serial);
+    const double parallelSeconds = buildSeconds(meshes, workers, parallel);
+
+    // Ekran hatası: sahnedeki gibi 45 derece görüş alanı, 900 piksel yükseklik
+    const float pixelScale = lodPixelScale(glm::radians(45.0f), 900.0f);
+    const size_t ratioCount = sizeof(DEFAULT_LOD_RATIOS) / sizeof(float);
+    size_t mismatches = 0;
+    for (size_t m = 0; m < meshes.size(); ++m)
+    {
+        std::cout << names[m] << std::endl;
+        for (size_t level = 0; level < ratioCount; ++level)
+        {
+            const MeshLod &lod = serial[m][level];
+            std::cout << "  %" << std::setw(5) << std::left << DEFAULT_LOD_RATIOS[level] * 100.0f << std::right
+                      << std::setw(7) << lod.mesh.indices.size() / 3 << " üçgen" << std::setw(7)
+                      << lod.mesh.vertices.size() / 9 << " vertex, hata " << std::setw(10) << lod.error
+                      << ", 1 piksel uzaklığı " << lod.error * pixelScale / LOD_PIXEL_ERROR << std::endl;
+            if (!sameLod(lod, parallel[m][level]))
+                ++mismatches;
+        }
+
+        // Çizim tarafının göreceği zincir: sadeleşemeyen seviyeler atlanır
+        const LodChain<size_t> chain = makeLodChain<size_t>(serial[m], [](const WeldedMesh &mesh)
+                                                            { return mesh.indices.size() / 3; });
+        std::cout << "  LodChain: " << chain.levelCount() << " seviye" << std::endl;
+    }
+
+    std::cout << "buildLodChains: 1 iş parçacığı " << serialSeconds * 1000.0 << " ms, " << workers << " iş parçacığı "
+              << parallelSeconds * 1000.0 << " ms (donanım: " << workerCount() << ")" << std::endl;
+    if (mismatches)
+    {
+        std::cerr << "ERROR::SIMPLIFY::NONDETERMINISTIC " << mismatches
+                  << " seviye iş parçacığı sayısına göre farklı çıktı" << std::endl;
+        return 1;
+    }
+    std::cout << "Çıktılar iş parçacığı sayısından bağımsız" << std::endl;
+    return 0;
+}
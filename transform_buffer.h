@@ -0,0 +1,149 @@
+#ifndef TRANSFORM_BUFFER_H
+#define TRANSFORM_BUFFER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "gl_state.h"
+
+// Dönüşüm tamponunun bağlandığı doku birimi
+const GLuint TRANSFORM_BUFFER_UNIT = 0;
+
+// Çizim başına dönüşümleri texture buffer'dan okuyan GLSL parçası.
+// Her çizim TRANSFORM_TEXELS RGBA32F texel kaplar: MVP (4), model (4) ve
+// normal matrisi (3 sütun); örneklemeli çizimlerde gl_InstanceID eklenir.
+#define TRANSFORM_BUFFER_GLSL                                      \
+    "uniform samplerBuffer transforms;\n"                          \
+    "uniform int drawIndex;\n"                                     \
+    "const int TRANSFORM_TEXELS = 11;\n"                           \
+    "int transformBase()\n"                                        \
+    "{\n"                                                          \
+    "    return (drawIndex + gl_InstanceID) * TRANSFORM_TEXELS;\n" \
+    "}\n"                                                          \
+    "mat4 fetchMat4(int base)\n"                                   \
+    "{\n"                                                          \
+    "    return mat4(texelFetch(transforms, base),\n"              \
+    "                texelFetch(transforms, base + 1),\n"          \
+    "                texelFetch(transforms, base + 2),\n"          \
+    "                texelFetch(transforms, base + 3));\n"         \
+    "}\n"                                                          \
+    "mat3 fetchMat3(int base)\n"                                   \
+    "{\n"                                                          \
+    "    return mat3(texelFetch(transforms, base).xyz,\n"          \
+    "                texelFetch(transforms, base + 1).xyz,\n"      \
+    "                texelFetch(transforms, base + 2).xyz);\n"     \
+    "}\n"
+
+// GPU'daki çizim başına dönüşüm; düzeni TRANSFORM_BUFFER_GLSL ile aynı
+struct DrawTransform
+{
+    glm::mat4 mvp;
+    glm::mat4 model;
+    glm::vec4 normalMatrix[3];
+};
+static_assert(sizeof(DrawTransform) == 11 * sizeof(glm::vec4), "DrawTransform 11 texel olmalı");
+
+// Normal matrisi: transpose(inverse(mat3(model))) yerine kofaktör matrisi.
+// İkisi arasında sadece det(model) kadar ölçek farkı var ve shader normali
+// zaten normalize ediyor; böylece bölme gerekmez. Aynalayan dönüşümlerde
+// (det < 0) yön korunsun diye determinantın işaretiyle çarpılır.
+inline glm::mat3 normalMatrix(const glm::mat4 &model)
+{
+    const glm::vec3 c0(model[0]), c1(model[1]), c2(model[2]);
+    const glm::vec3 n0 = glm::cross(c1, c2);
+    const float sign = glm::dot(c0, n0) < 0.0f ? -1.0f : 1.0f;
+    return glm::mat3(n0 * sign, glm::cross(c2, c0) * sign, glm::cross(c0, c1) * sign);
+}
+
+// Bütün çizimlerin MVP ve normal matrislerini tek döngüde hesaplar. Girdi ve
+// çıktı ardışık dizilerdir ve döngü gövdesi sadece vec4 çarpma/toplamalarından
+// oluşur; derleyici bunu SIMD komutlarına çevirebilir.
+inline void computeDrawTransforms(const glm::mat4 *models, size_t count,
+                                  const glm::mat4 &viewProjection, DrawTransform *out)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const glm::mat4 &m = models[i];
+        DrawTransform &t = out[i];
+        for (int c = 0; c < 4; ++c)
+            t.mvp[c] = viewProjection[0] * m[c].x + viewProjection[1] * m[c].y +
+                       viewProjection[2] * m[c].z + viewProjection[3] * m[c].w;
+        t.model = m;
+
+        const glm::mat3 n = normalMatrix(m);
+        t.normalMatrix[0] = glm::vec4(n[0], 0.0f);
+        t.normalMatrix[1] = glm::vec4(n[1], 0.0f);
+        t.normalMatrix[2] = glm::vec4(n[2], 0.0f);
+    }
+}
+
+// Bir karedeki bütün model matrisleri CPU'da toplanır; upload() MVP ve normal
+// matrislerini toplu hesaplayıp hepsini tek seferde GPU'ya gönderir.
+// Çizim başına sadece drawIndex (tek int) değişir.
+class TransformBuffer
+{
+public:
+    void create()
+    {
+        glGenBuffers(1, &buffer);
+        glGenTextures(1, &texture);
+
+        glState().bindBuffer(GL_TEXTURE_BUFFER, buffer);
+        glBufferData(GL_TEXTURE_BUFFER, sizeof(DrawTransform), NULL, GL_STREAM_DRAW);
+        glState().bindTexture(TRANSFORM_BUFFER_UNIT, GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+    }
+
+    // Yeni kare: önceki matrisler atılır
+    void clear()
+    {
+        matrices.clear();
+    }
+
+    // Matrisi ekler ve shaderdaki drawIndex değerini döner
+    int push(const glm::mat4 &model)
+    {
+        matrices.push_back(model);
+        return (int)matrices.size() - 1;
+    }
+
+    int count() const
+    {
+        return (int)matrices.size();
+    }
+
+    // Karenin bütün dönüşümleri tek glBufferData ile; eski içerik yetim bırakılır
+    // (orphaning), böylece GPU'nun hâlâ okuduğu veriyi beklemek gerekmez.
+    void upload(const glm::mat4 &viewProjection)
+    {
+        if (matrices.empty())
+            return;
+        transforms.resize(matrices.size());
+        computeDrawTransforms(matrices.data(), matrices.size(), viewProjection, transforms.data());
+
+        glState().bindBuffer(GL_TEXTURE_BUFFER, buffer);
+        glBufferData(GL_TEXTURE_BUFFER, transforms.size() * sizeof(DrawTransform), transforms.data(), GL_STREAM_DRAW);
+    }
+
+    void bind() const
+    {
+        glState().bindTexture(TRANSFORM_BUFFER_UNIT, GL_TEXTURE_BUFFER, texture);
+    }
+
+    void destroy()
+    {
+        glDeleteTextures(1, &texture);
+        glDeleteBuffers(1, &buffer);
+        texture = buffer = 0;
+    }
+
+private:
+    std::vector<glm::mat4> matrices;
+    std::vector<DrawTransform> transforms;
+    GLuint buffer = 0;
+    GLuint texture = 0;
+};
+
+#endif
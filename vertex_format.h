@@ -0,0 +1,129 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "vertex_layout.h"
+
+// GPU'daki vertex düzenleri. Meshler her zaman 9 float'lık (pozisyon, normal,
+// renk) dizilerden yüklenir; seçilen düzene dönüşüm upload sırasında yapılır.
+// Shader girişleri (vec3 aPos, aNormal, aColor) her düzende aynı kalır.
+using FloatVertexLayout = VertexLayout<Float3<0>, Float3<1>, Float3<2>>;       // 3+3+3 float, 36 bayt
+using PackedVertexLayout = VertexLayout<Float3<0>, Snorm10<1>, Unorm8<2>>;     // float pozisyon, 2_10_10_10 normal, RGBA8 renk, 20 bayt
+using PackedHalfVertexLayout = VertexLayout<Half3<0>, Snorm10<1>, Unorm8<2>>;  // half pozisyon, 2_10_10_10 normal, RGBA8 renk, 16 bayt
+
+static_assert(FloatVertexLayout::stride == 36, "float düzeni 36 bayt olmalı");
+static_assert(PackedVertexLayout::stride == 20, "packed düzeni 20 bayt olmalı");
+static_assert(PackedHalfVertexLayout::stride == 16, "packed-half düzeni 16 bayt olmalı");
+
+// Half pozisyonun yuvarlama hatası |p| * 2^-11'i geçmez (11 bit mantis); bu
+// hata bu sınırın altında kalıyorsa pozisyonlar 16 baytlık düzene sığar
+const float HALF_POSITION_MAX_ERROR = 0.005f;
+
+inline bool halfPositionsFit(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+{
+    const glm::vec3 extent = glm::max(glm::abs(boundsMin), glm::abs(boundsMax));
+    return glm::max(extent.x, glm::max(extent.y, extent.z)) / 2048.0f <= HALF_POSITION_MAX_ERROR;
+}
+
+// Yükleme düzenini çalışma zamanında seçer: upload(PackedHalfVertexLayout())
+// ya da upload(PackedVertexLayout()) çağrılır, düzen tipi decltype ile alınır
+template <class F>
+inline auto withPositionLayout(bool halfPositions, F &&upload)
+{
+    if (halfPositions)
+        return upload(PackedHalfVertexLayout());
+    return upload(PackedVertexLayout());
+}
+
+// GL_INT_2_10_10_10_REV: x, y, z 10 bit işaretli normalize, w 2 bit
+inline uint32_t packNormal(const float *n)
+{
+    glm::vec3 normal(n[0], n[1], n[2]);
+    float length = glm::length(normal);
+    if (length > 0.0f)
+        normal /= length;
+    return glm::packSnorm3x10_1x2(glm::vec4(normal, 0.0f));
+}
+
+// GL_UNSIGNED_BYTE x4 normalize, bellekte R, G, B, A sırasıyla
+inline uint32_t packColor(const float *c)
+{
+    return glm::packUnorm4x8(glm::vec4(c[0], c[1], c[2], 1.0f));
+}
+
+// 9 float'lık vertexin bir attribute'unu düzenin tipine kodlar. Konum 0
+// pozisyon, 1 normal, 2 renk kaynağını seçer.
+template <class A>
+inline void encodeAttribute(unsigned char *dst, const float *vertex)
+{
+    const float *src = vertex + A::location * 3;
+    if constexpr (A::type == GL_FLOAT)
+    {
+        std::memcpy(dst, src, A::components * sizeof(float));
+    }
+    else if constexpr (A::type == GL_HALF_FLOAT)
+    {
+        uint16_t halves[A::size / sizeof(uint16_t)] = {};
+        for (GLint i = 0; i < A::components; ++i)
+            halves[i] = glm::packHalf1x16(src[i]);
+        std::memcpy(dst, halves, sizeof(halves));
+    }
+    else if constexpr (A::type == GL_INT_2_10_10_10_REV)
+    {
+        uint32_t normal = packNormal(src);
+        std::memcpy(dst, &normal, sizeof(normal));
+    }
+    else
+    {
+        static_assert(A::type == GL_UNSIGNED_BYTE && A::components == 4, "Desteklenmeyen vertex attribute tipi");
+        uint32_t color = packColor(src);
+        std::memcpy(dst, &color, sizeof(color));
+    }
+}
+
+template <class Layout, size_t... I>
+inline void encodeVertex(unsigned char *dst, const float *vertex, std::index_sequence<I...>)
+{
+    (encodeAttribute<typename Layout::template attribute<I>>(dst + Layout::template offset<I>(), vertex), ...);
+}
+
+template <class Layout>
+inline void encodeVertex(unsigned char *dst, const float *vertex)
+{
+    encodeVertex<Layout>(dst, vertex, std::make_index_sequence<Layout::count>());
+}
+
+// vertexCount tane 9 float'lık vertexi seçilen düzende dst'ye yazar (dst
+// eşlenmiş GPU belleği olabilir; yalnızca yazılır, hiç okunmaz)
+template <class Layout>
+inline void convertVerticesInto(const float *vertices, size_t vertexCount, unsigned char *dst)
+{
+    if constexpr (std::is_same<Layout, FloatVertexLayout>::value)
+    {
+        std::memcpy(dst, vertices, vertexCount * Layout::stride);
+        return;
+    }
+
+    for (size_t i = 0; i < vertexCount; ++i)
+        encodeVertex<Layout>(dst + i * Layout::stride, vertices + i * 9);
+}
+
+// 9 float'lık vertexleri seçilen düzene çevirir
+template <class Layout>
+inline std::vector<unsigned char> convertVertices(const std::vector<float> &vertices)
+{
+    const size_t vertexCount = vertices.size() / 9;
+    std::vector<unsigned char> out(vertexCount * Layout::stride);
+    convertVerticesInto<Layout>(vertices.data(), vertexCount, out.data());
+    return out;
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef VERTEX_LAYOUT_H
+#define VERTEX_LAYOUT_H
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+// Bir attribute'un bayt boyutu; paketli 2_10_10_10 tipleri bileşen sayısından
+// bağımsız olarak 4 bayttır
+constexpr GLsizei attributeSize(GLenum type, GLint components)
+{
+    return (type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV) ? 4
+           : (type == GL_FLOAT || type == GL_INT || type == GL_UNSIGNED_INT)       ? components * 4
+           : (type == GL_HALF_FLOAT || type == GL_SHORT || type == GL_UNSIGNED_SHORT) ? components * 2
+                                                                                     : components;
+}
+
+// Tek vertex attribute'u: shader konumu, bileşen sayısı, GL tipi, normalize ve
+// bayt boyutu. Size, bileşenlerin kapladığından büyük olabilir (hizalama dolgusu);
+// Integer ise glVertexAttribIPointer ile tamsayı olarak okunur.
+template <GLuint Location, GLint Components, GLenum Type, bool Normalized = false,
+          GLsizei Size = attributeSize(Type, Components), bool Integer = false>
+struct Attr
+{
+    static constexpr GLuint location = Location;
+    static constexpr GLint components = Components;
+    static constexpr GLenum type = Type;
+    static constexpr GLboolean normalized = Normalized ? GL_TRUE : GL_FALSE;
+    static constexpr GLsizei size = Size;
+    static constexpr bool integer = Integer;
+};
+
+// Sık kullanılan attributelar
+template <GLuint Location>
+using Float3 = Attr<Location, 3, GL_FLOAT>;
+template <GLuint Location>
+using Half3 = Attr<Location, 3, GL_HALF_FLOAT, false, 8>; // 4 bayta hizalı, son half dolgu
+template <GLuint Location>
+using Snorm10 = Attr<Location, 4, GL_INT_2_10_10_10_REV, true>;
+template <GLuint Location>
+using Unorm8 = Attr<Location, 4, GL_UNSIGNED_BYTE, true>;
+template <GLuint Location>
+using UInt1 = Attr<Location, 1, GL_UNSIGNED_INT, false, 4, true>;
+
+// Sıkı paketlenmiş (interleaved) vertex düzeni. Stride ve ofsetler derleme
+// zamanında hesaplanır; setup() her attribute için sabit argümanlı GL çağrıları
+// üretir, çalışma zamanında hiçbir düzen seçimi yapılmaz. Düzen değiştirmek
+// (örneğin paketli normal, half pozisyon) tek bir tip değişikliğidir.
+template <class... Attrs>
+class VertexLayout
+{
+public:
+    static_assert(sizeof...(Attrs) > 0, "Düzen en az bir attribute içermeli");
+    static_assert(((Attrs::size % 4 == 0) && ...), "Attributelar 4 bayta hizalı olmalı");
+
+    static constexpr size_t count = sizeof...(Attrs);
+    static constexpr GLsizei stride = (Attrs::size + ...);
+
+    template <size_t I>
+    using attribute = std::tuple_element_t<I, std::tuple<Attrs...>>;
+
+    // I. attribute'un vertex içindeki bayt ofseti
+    template <size_t I>
+    static constexpr GLsizei offset()
+    {
+        constexpr GLsizei sizes[] = {Attrs::size...};
+        GLsizei result = 0;
+        for (size_t i = 0; i < I; ++i)
+            result += sizes[i];
+        return result;
+    }
+
+    // Bağlı VAO ve GL_ARRAY_BUFFER için attributeları kurar
+    static void setup()
+    {
+        setupPointers(std::index_sequence_for<Attrs...>());
+    }
+
+    // DSA (GL 4.5) sürümü: vao'nun binding noktasındaki buffer için kurar; hiçbir
+    // şey bağlanmaz. Divisor DSA'da binding'e aittir (glVertexArrayBindingDivisor)
+    static void setup(GLuint vao, GLuint binding)
+    {
+        setupFormats(vao, binding, std::index_sequence_for<Attrs...>());
+    }
+
+private:
+    template <size_t... I>
+    static void setupPointers(std::index_sequence<I...>)
+    {
+        (setupPointer<attribute<I>>(offset<I>()), ...);
+    }
+
+    template <class A>
+    static void setupPointer(GLsizei offset)
+    {
+        if constexpr (A::integer)
+            glVertexAttribIPointer(A::location, A::components, A::type, stride, (void *)(size_t)offset);
+        else
+            glVertexAttribPointer(A::location, A::components, A::type, A::normalized, stride, (void *)(size_t)offset);
+        glEnableVertexAttribArray(A::location);
+    }
+
+    template <size_t... I>
+    static void setupFormats(GLuint vao, GLuint binding, std::index_sequence<I...>)
+    {
+        (setupFormat<attribute<I>>(vao, binding, offset<I>()), ...);
+    }
+
+    template <class A>
+    static void setupFormat(GLuint vao, GLuint binding, GLsizei offset)
+    {
+        if constexpr (A::integer)
+            glVertexArrayAttribIFormat(vao, A::location, A::components, A::type, offset);
+        else
+            glVertexArrayAttribFormat(vao, A::location, A::components, A::type, A::normalized, offset);
+        glVertexArrayAttribBinding(vao, A::location, binding);
+        glEnableVertexArrayAttrib(vao, A::location);
+    }
+};
+
+#endif
@@ -0,0 +1,1101 @@
+#ifndef VULKAN_RENDERER_H
+#define VULKAN_RENDERER_H
+
+#ifdef USE_VULKAN
+
+#include <vulkan/vulkan.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "frame_data.h"
+#include "mesh_optimize.h"
+#include "mesh_weld.h"
+#include "procedural_mesh.h"
+#include "static_batch.h"
+#include "transform_buffer.h"
+#include "vertex_format.h"
+
+// Nesne başına push constant verisi; düzeni shaders/vulkan_scene.vert ile aynı
+struct VulkanObjectData
+{
+    glm::mat4 model;
+    glm::vec4 normalMatrix[3];
+};
+static_assert(sizeof(VulkanObjectData) == 112, "VulkanObjectData 112 bayt olmalı");
+
+// GL kırpma uzayından Vulkan'a: y ters, derinlik [-1, 1] yerine [0, 1].
+// glm::perspective'in sonucu bununla soldan çarpılır.
+inline glm::mat4 vulkanClipCorrection()
+{
+    return glm::mat4(1.0f, 0.0f, 0.0f, 0.0f,
+                     0.0f, -1.0f, 0.0f, 0.0f,
+                     0.0f, 0.0f, 0.5f, 0.0f,
+                     0.0f, 0.0f, 0.5f, 1.0f);
+}
+
+// GL vertex attribute tipinin Vulkan formatı (vertex_layout.h'deki attributelar)
+constexpr VkFormat vulkanVertexFormat(GLenum type, GLint components, GLboolean normalized)
+{
+    return type == GL_FLOAT ? (components == 1   ? VK_FORMAT_R32_SFLOAT
+                               : components == 2 ? VK_FORMAT_R32G32_SFLOAT
+                               : components == 3 ? VK_FORMAT_R32G32B32_SFLOAT
+                                                 : VK_FORMAT_R32G32B32A32_SFLOAT)
+           // 3 bileşenli half format zorunlu değil; Half3 zaten 4. bileşen kadar dolgulu
+           : type == GL_HALF_FLOAT                          ? VK_FORMAT_R16G16B16A16_SFLOAT
+           : type == GL_INT_2_10_10_10_REV && normalized    ? VK_FORMAT_A2B10G10R10_SNORM_PACK32
+           : type == GL_UNSIGNED_BYTE && normalized         ? VK_FORMAT_R8G8B8A8_UNORM
+           : type == GL_UNSIGNED_INT && components == 1     ? VK_FORMAT_R32_UINT
+                                                            : VK_FORMAT_UNDEFINED;
+}
+
+// Aynı sahnenin Vulkan yolu (-DUSE_VULKAN ile derlenir, lavapipe dahil her
+// Vulkan 1.0 sürücüsünde çalışır):
+//  - geometri AzdoRenderer'daki gibi üçgen listesine çevrilip kaynaklanır ve
+//    tek vertex/indeks tamponunda (device local, staging ile) durur;
+//  - statik yığın, uçuştaki her kare için bir kez ikincil komut tamponuna
+//    kaydedilir ve her karede sadece vkCmdExecuteCommands ile çalıştırılır
+//    (swapchain yeniden kurulunca tekrar kaydedilir);
+//  - hareketli nesneler (lamba) her karede küçük bir ikincil tampona yazılır;
+//  - nesne başına model/normal matrisi push constant, kare verisi (FrameData)
+//    kalıcı eşlenmiş uniform buffer ile gider.
+// Hatalar std::cerr'e "ERROR::VULKAN::..." olarak yazılır ve create() false döner.
+class VulkanRenderer
+{
+public:
+    static const uint32_t FRAME_COUNT = 2;
+
+    // 9 float'lık vertexleri ekler; models[drawIndex] ile her karede çizilir
+    void addMesh(const float *data, size_t vertexCount, GLenum mode, uint32_t drawIndex)
+    {
+        addDraw(data, vertexCount, mode, drawIndex, false);
+    }
+
+    // Prosedürel mesh zaten indeksli üretilir; kaynaklamaya gerek yok.
+    // Çizimin indeksini döndürür (setDrawEnabled için)
+    size_t addProcedural(const ProceduralMeshDesc &desc, uint32_t drawIndex)
+    {
+        Draw draw;
+        draw.indexCount = (uint32_t)proceduralMeshSize(desc).indexCount;
+        draw.firstIndex = (uint32_t)indices.size();
+        draw.vertexOffset = (int32_t)(vertices.size() / 9);
+        draw.drawIndex = drawIndex;
+        draw.isStatic = false;
+        draw.enabled = true;
+        draws.push_back(draw);
+
+        const size_t firstVertex = vertices.size() / 9;
+        generateProceduralMesh(desc, vertices, indices);
+        const size_t meshVertexCount = optimizeMesh(&vertices[firstVertex * 9], vertices.size() / 9 - firstVertex,
+                                                    &indices[draw.firstIndex], draw.indexCount, &cacheStats);
+        vertices.resize((firstVertex + meshVertexCount) * 9);
+        return draws.size() - 1;
+    }
+
+    // Hareketli çizimleri açar / kapatır (LOD seçimi gibi); dinamik tampon her
+    // karede kaydedildiği için sonraki karede geçerli. Statik çizimler etkilenmez.
+    void setDrawEnabled(size_t draw, bool enabled)
+    {
+        draws[draw].enabled = enabled;
+    }
+
+    // Statik yığının nesneleri dünya uzayında; birim model ile önceden kaydedilir
+    void addStaticBatch(const StaticBatch &batch)
+    {
+        const std::vector<float> &data = batch.vertexData();
+        for (const StaticBatch::Object &object : batch.objectList())
+            addDraw(data.data() + object.first * 9, object.count, GL_TRIANGLES, 0, true);
+    }
+
+    template <class Layout>
+    bool create(GLFWwindow *window, const char *vertexSpirvPath, const char *fragmentSpirvPath)
+    {
+        this->window = window;
+        useLayout<Layout>();
+
+        if (!createInstance() || !createSurface() || !pickPhysicalDevice() || !createDevice())
+            return false;
+
+        // Paketli formatlar (2_10_10_10 normal gibi) Vulkan'da zorunlu değil
+        for (const VkVertexInputAttributeDescription &attribute : vertexAttributes)
+        {
+            VkFormatProperties properties;
+            vkGetPhysicalDeviceFormatProperties(physicalDevice, attribute.format, &properties);
+            if (!(properties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT))
+            {
+                std::cerr << "ERROR::VULKAN::VERTEX_FORMAT_UNSUPPORTED " << attribute.format
+                          << " (float düzene geçiliyor)" << std::endl;
+                useLayout<FloatVertexLayout>();
+                break;
+            }
+        }
+
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = queueFamily;
+        if (!check(vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool), "COMMAND_POOL_FAILED"))
+            return false;
+
+        if (!createSwapchain() || !createRenderPass() || !createFramebuffers())
+            return false;
+        if (!createDescriptors() || !createPipeline(vertexSpirvPath, fragmentSpirvPath))
+            return false;
+        if (!uploadGeometry() || !createFrames())
+            return false;
+
+        recordStaticCommands();
+
+        std::cout << "Vulkan: " << draws.size() << " çizim, " << vertexCount << " vertex, " << indexCount
+                  << " indeks (" << vertexStride << " bayt/vertex)" << std::endl;
+        cacheStats.print(std::cout);
+        return true;
+    }
+
+    VkExtent2D extent() const
+    {
+        return swapchainExtent;
+    }
+
+    // Kare verisini yazar, hareketli nesneleri kaydeder ve sunar
+    void draw(const FrameData &frame, const glm::mat4 *models, size_t modelCount)
+    {
+        Frame &f = frames[frameIndex];
+        vkWaitForFences(device, 1, &f.fence, VK_TRUE, UINT64_MAX);
+
+        uint32_t imageIndex = 0;
+        VkResult result = vkAcquireNextImageKHR(device, swapchain, UINT64_MAX, f.imageAvailable, VK_NULL_HANDLE, &imageIndex);
+        if (result == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            recreateSwapchain();
+            return;
+        }
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+        {
+            std::cerr << "ERROR::VULKAN::ACQUIRE_FAILED " << result << std::endl;
+            return;
+        }
+
+        std::memcpy(f.uniformData, &frame, sizeof(FrameData));
+        recordDynamicCommands(f, models, modelCount);
+
+        vkResetCommandBuffer(f.primary, 0);
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(f.primary, &beginInfo);
+
+        VkClearValue clearValues[2] = {};
+        clearValues[0].color.float32[0] = 0.1f;
+        clearValues[0].color.float32[1] = 0.1f;
+        clearValues[0].color.float32[2] = 0.1f;
+        clearValues[0].color.float32[3] = 1.0f;
+        clearValues[1].depthStencil.depth = 1.0f;
+
+        VkRenderPassBeginInfo passInfo = {};
+        passInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        passInfo.renderPass = renderPass;
+        passInfo.framebuffer = framebuffers[imageIndex];
+        passInfo.renderArea.extent = swapchainExtent;
+        passInfo.clearValueCount = 2;
+        passInfo.pClearValues = clearValues;
+        vkCmdBeginRenderPass(f.primary, &passInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+        VkCommandBuffer secondaries[2] = {f.staticCommands, f.dynamicCommands};
+        vkCmdExecuteCommands(f.primary, 2, secondaries);
+        vkCmdEndRenderPass(f.primary);
+        vkEndCommandBuffer(f.primary);
+
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &f.imageAvailable;
+        submitInfo.pWaitDstStageMask = &waitStage;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &f.primary;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &renderFinished[imageIndex];
+        // Çit sadece gönderimden hemen önce sıfırlanır. Gönderim başarısız olursa
+        // boş bir gönderim hem edinilen görüntünün semaforunu tüketir hem de çiti
+        // yeniden işaretler; yoksa bu kare yuvasının bir sonraki beklemesi hiç dönmez.
+        vkResetFences(device, 1, &f.fence);
+        if (!check(vkQueueSubmit(queue, 1, &submitInfo, f.fence), "QUEUE_SUBMIT_FAILED"))
+        {
+            submitInfo.commandBufferCount = 0;
+            submitInfo.signalSemaphoreCount = 0;
+            check(vkQueueSubmit(queue, 1, &submitInfo, f.fence), "QUEUE_SUBMIT_FAILED");
+            return;
+        }
+
+        VkPresentInfoKHR presentInfo = {};
+        presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.waitSemaphoreCount = 1;
+        presentInfo.pWaitSemaphores = &renderFinished[imageIndex];
+        presentInfo.swapchainCount = 1;
+        presentInfo.pSwapchains = &swapchain;
+        presentInfo.pImageIndices = &imageIndex;
+        result = vkQueuePresentKHR(queue, &presentInfo);
+
+        frameIndex = (frameIndex + 1) % FRAME_COUNT;
+
+        // Yüzeyin boyutu pencereden farklı olabilir (currentExtent sabit, HiDPI):
+        // swapchain'in kendi boyutuyla değil, kurulduğu andaki pencereyle karşılaştırılır
+        int width = 0, height = 0;
+        glfwGetFramebufferSize(window, &width, &height);
+        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || width != framebufferWidth ||
+            height != framebufferHeight)
+            recreateSwapchain();
+    }
+
+    void destroy()
+    {
+        if (!device)
+        {
+            destroyInstance();
+            return;
+        }
+        vkDeviceWaitIdle(device);
+
+        for (Frame &f : frames)
+        {
+            vkDestroyFence(device, f.fence, nullptr);
+            vkDestroySemaphore(device, f.imageAvailable, nullptr);
+            destroyBuffer(f.uniformBuffer, f.uniformMemory);
+        }
+        destroyBuffer(vertexBuffer, vertexMemory);
+        destroyBuffer(indexBuffer, indexMemory);
+
+        destroySwapchain();
+        vkDestroyPipeline(device, pipeline, nullptr);
+        vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+        vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);
+        vkDestroyRenderPass(device, renderPass, nullptr);
+        vkDestroyCommandPool(device, commandPool, nullptr);
+        vkDestroyDevice(device, nullptr);
+        device = VK_NULL_HANDLE;
+        destroyInstance();
+    }
+
+private:
+    // Tek indeksli çizim; static ise önceden kaydedilen tampona girer
+    struct Draw
+    {
+        uint32_t indexCount;
+        uint32_t firstIndex;
+        int32_t vertexOffset;
+        uint32_t drawIndex;
+        bool isStatic;
+        bool enabled;
+    };
+
+    // Uçuştaki kare başına kaynaklar
+    struct Frame
+    {
+        VkCommandBuffer primary = VK_NULL_HANDLE;
+        VkCommandBuffer staticCommands = VK_NULL_HANDLE;
+        VkCommandBuffer dynamicCommands = VK_NULL_HANDLE;
+        VkSemaphore imageAvailable = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        VkBuffer uniformBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory uniformMemory = VK_NULL_HANDLE;
+        void *uniformData = nullptr;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    };
+
+    static bool check(VkResult result, const char *what)
+    {
+        if (result == VK_SUCCESS)
+            return true;
+        std::cerr << "ERROR::VULKAN::" << what << " " << result << std::endl;
+        return false;
+    }
+
+    // Düzenin stride'ı, attribute açıklamaları ve dönüştürücüsü; hepsi derleme
+    // zamanında belirli, sadece desteklenmeyen format için float'a düşülür
+    template <class Layout>
+    void useLayout()
+    {
+        vertexStride = Layout::stride;
+        vertexAttributes = vulkanAttributes<Layout>(std::make_index_sequence<Layout::count>());
+        convert = &convertVertices<Layout>;
+    }
+
+    template <class Layout, size_t... I>
+    static std::vector<VkVertexInputAttributeDescription> vulkanAttributes(std::index_sequence<I...>)
+    {
+        return {vulkanAttribute<typename Layout::template attribute<I>>(Layout::template offset<I>())...};
+    }
+
+    template <class A>
+    static VkVertexInputAttributeDescription vulkanAttribute(uint32_t offset)
+    {
+        static_assert(vulkanVertexFormat(A::type, A::components, A::normalized) != VK_FORMAT_UNDEFINED,
+                      "Attribute tipinin Vulkan karşılığı yok");
+        return {A::location, 0, vulkanVertexFormat(A::type, A::components, A::normalized), offset};
+    }
+
+    void addDraw(const float *data, size_t count, GLenum mode, uint32_t drawIndex, bool isStatic)
+    {
+        std::vector<float> triangles = toTriangleList(data, count, mode);
+        WeldedMesh mesh = weldVertices(triangles.data(), triangles.size() / 9);
+        mesh.vertices.resize(optimizeMesh(mesh.vertices.data(), mesh.vertices.size() / 9, mesh.indices.data(),
+                                          mesh.indices.size(), &cacheStats) * 9);
+
+        Draw draw;
+        draw.indexCount = (uint32_t)mesh.indices.size();
+        draw.firstIndex = (uint32_t)indices.size();
+        draw.vertexOffset = (int32_t)(vertices.size() / 9);
+        draw.drawIndex = drawIndex;
+        draw.isStatic = isStatic;
+        draw.enabled = true;
+        draws.push_back(draw);
+
+        vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+        indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+    }
+
+    bool createInstance()
+    {
+        uint32_t extensionCount = 0;
+        const char **extensions = glfwGetRequiredInstanceExtensions(&extensionCount);
+        if (!extensions)
+        {
+            std::cerr << "ERROR::VULKAN::NO_SURFACE_EXTENSIONS" << std::endl;
+            return false;
+        }
+
+        VkApplicationInfo appInfo = {};
+        appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        appInfo.pApplicationName = "3D Oda";
+        appInfo.apiVersion = VK_API_VERSION_1_0;
+
+        VkInstanceCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        createInfo.pApplicationInfo = &appInfo;
+        createInfo.enabledExtensionCount = extensionCount;
+        createInfo.ppEnabledExtensionNames = extensions;
+        return check(vkCreateInstance(&createInfo, nullptr, &instance), "INSTANCE_FAILED");
+    }
+
+    bool createSurface()
+    {
+        return check(glfwCreateWindowSurface(instance, window, nullptr, &surface), "SURFACE_FAILED");
+    }
+
+    // Grafik + sunum yapabilen ilk kuyruk ailesi olan cihaz
+    bool pickPhysicalDevice()
+    {
+        uint32_t count = 0;
+        vkEnumeratePhysicalDevices(instance, &count, nullptr);
+        std::vector<VkPhysicalDevice> devices(count);
+        vkEnumeratePhysicalDevices(instance, &count, devices.data());
+
+        for (VkPhysicalDevice candidate : devices)
+        {
+            uint32_t familyCount = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(candidate, &familyCount, nullptr);
+            std::vector<VkQueueFamilyProperties> families(familyCount);
+            vkGetPhysicalDeviceQueueFamilyProperties(candidate, &familyCount, families.data());
+
+            for (uint32_t i = 0; i < familyCount; ++i)
+            {
+                VkBool32 present = VK_FALSE;
+                vkGetPhysicalDeviceSurfaceSupportKHR(candidate, i, surface, &present);
+                if ((families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) && present)
+                {
+                    physicalDevice = candidate;
+                    queueFamily = i;
+
+                    VkPhysicalDeviceProperties properties;
+                    vkGetPhysicalDeviceProperties(candidate, &properties);
+                    std::cout << "Vulkan cihazı: " << properties.deviceName << std::endl;
+                    return true;
+                }
+            }
+        }
+        std::cerr << "ERROR::VULKAN::NO_SUITABLE_DEVICE" << std::endl;
+        return false;
+    }
+
+    bool createDevice()
+    {
+        const float priority = 1.0f;
+        VkDeviceQueueCreateInfo queueInfo = {};
+        queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueInfo.queueFamilyIndex = queueFamily;
+        queueInfo.queueCount = 1;
+        queueInfo.pQueuePriorities = &priority;
+
+        const char *extensions[] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+        VkDeviceCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        createInfo.queueCreateInfoCount = 1;
+        createInfo.pQueueCreateInfos = &queueInfo;
+        createInfo.enabledExtensionCount = 1;
+        createInfo.ppEnabledExtensionNames = extensions;
+        if (!check(vkCreateDevice(physicalDevice, &createInfo, nullptr, &device), "DEVICE_FAILED"))
+            return false;
+        vkGetDeviceQueue(device, queueFamily, 0, &queue);
+        return true;
+    }
+
+    bool createSwapchain()
+    {
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        VkSurfaceCapabilitiesKHR capabilities;
+        vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, &capabilities);
+
+        uint32_t formatCount = 0;
+        vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, nullptr);
+        std::vector<VkSurfaceFormatKHR> formats(formatCount);
+        vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, formats.data());
+        if (formats.empty())
+        {
+            std::cerr << "ERROR::VULKAN::NO_SURFACE_FORMAT" << std::endl;
+            return false;
+        }
+
+        // GL yolu gibi doğrusal (UNORM) çıktı; yoksa ilk format
+        VkSurfaceFormatKHR surfaceFormat = formats[0];
+        for (const VkSurfaceFormatKHR &candidate : formats)
+            if (candidate.format == VK_FORMAT_B8G8R8A8_UNORM || candidate.format == VK_FORMAT_R8G8B8A8_UNORM)
+            {
+                surfaceFormat = candidate;
+                break;
+            }
+        colorFormat = surfaceFormat.format;
+
+        swapchainExtent = capabilities.currentExtent;
+        if (swapchainExtent.width == UINT32_MAX)
+        {
+            swapchainExtent.width = glm::clamp((uint32_t)framebufferWidth, capabilities.minImageExtent.width,
+                                               capabilities.maxImageExtent.width);
+            swapchainExtent.height = glm::clamp((uint32_t)framebufferHeight, capabilities.minImageExtent.height,
+                                                capabilities.maxImageExtent.height);
+        }
+
+        uint32_t imageCount = capabilities.minImageCount + 1;
+        if (capabilities.maxImageCount > 0 && imageCount > capabilities.maxImageCount)
+            imageCount = capabilities.maxImageCount;
+
+        VkSwapchainCreateInfoKHR createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+        createInfo.surface = surface;
+        createInfo.minImageCount = imageCount;
+        createInfo.imageFormat = surfaceFormat.format;
+        createInfo.imageColorSpace = surfaceFormat.colorSpace;
+        createInfo.imageExtent = swapchainExtent;
+        createInfo.imageArrayLayers = 1;
+        createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.preTransform = capabilities.currentTransform;
+        createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+        createInfo.presentMode = VK_PRESENT_MODE_FIFO_KHR; // glfwSwapInterval(1) karşılığı, her sürücüde var
+        createInfo.clipped = VK_TRUE;
+        if (!check(vkCreateSwapchainKHR(device, &createInfo, nullptr, &swapchain), "SWAPCHAIN_FAILED"))
+            return false;
+
+        vkGetSwapchainImagesKHR(device, swapchain, &imageCount, nullptr);
+        swapchainImages.resize(imageCount);
+        vkGetSwapchainImagesKHR(device, swapchain, &imageCount, swapchainImages.data());
+
+        imageViews.resize(imageCount);
+        for (uint32_t i = 0; i < imageCount; ++i)
+            if (!createImageView(swapchainImages[i], colorFormat, VK_IMAGE_ASPECT_COLOR_BIT, imageViews[i]))
+                return false;
+
+        // Sunum semaforu görüntü başına: görüntü tekrar alınana kadar serbest kalmaz
+        renderFinished.resize(imageCount);
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        for (VkSemaphore &semaphore : renderFinished)
+            if (!check(vkCreateSemaphore(device, &semaphoreInfo, nullptr, &semaphore), "SEMAPHORE_FAILED"))
+                return false;
+
+        // Derinlik tamponu
+        VkImageCreateInfo depthInfo = {};
+        depthInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        depthInfo.imageType = VK_IMAGE_TYPE_2D;
+        depthInfo.format = DEPTH_FORMAT;
+        depthInfo.extent = {swapchainExtent.width, swapchainExtent.height, 1};
+        depthInfo.mipLevels = 1;
+        depthInfo.arrayLayers = 1;
+        depthInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        depthInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        depthInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        depthInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        if (!check(vkCreateImage(device, &depthInfo, nullptr, &depthImage), "DEPTH_IMAGE_FAILED"))
+            return false;
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device, depthImage, &requirements);
+        if (!allocate(requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, depthMemory))
+            return false;
+        vkBindImageMemory(device, depthImage, depthMemory, 0);
+        return createImageView(depthImage, DEPTH_FORMAT, VK_IMAGE_ASPECT_DEPTH_BIT, depthView);
+    }
+
+    bool createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspect, VkImageView &view)
+    {
+        VkImageViewCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        createInfo.image = image;
+        createInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        createInfo.format = format;
+        createInfo.subresourceRange.aspectMask = aspect;
+        createInfo.subresourceRange.levelCount = 1;
+        createInfo.subresourceRange.layerCount = 1;
+        return check(vkCreateImageView(device, &createInfo, nullptr, &view), "IMAGE_VIEW_FAILED");
+    }
+
+    bool createRenderPass()
+    {
+        VkAttachmentDescription attachments[2] = {};
+        attachments[0].format = colorFormat;
+        attachments[0].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[0].finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+        attachments[1].format = DEPTH_FORMAT;
+        attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference colorRef = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        VkAttachmentReference depthRef = {1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &colorRef;
+        subpass.pDepthStencilAttachment = &depthRef;
+
+        // Görüntü alınmadan ve önceki karenin derinliği bitmeden yazılmasın
+        VkSubpassDependency dependency = {};
+        dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependency.dstSubpass = 0;
+        dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+        VkRenderPassCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        createInfo.attachmentCount = 2;
+        createInfo.pAttachments = attachments;
+        createInfo.subpassCount = 1;
+        createInfo.pSubpasses = &subpass;
+        createInfo.dependencyCount = 1;
+        createInfo.pDependencies = &dependency;
+        return check(vkCreateRenderPass(device, &createInfo, nullptr, &renderPass), "RENDER_PASS_FAILED");
+    }
+
+    bool createFramebuffers()
+    {
+        framebuffers.resize(imageViews.size());
+        for (size_t i = 0; i < imageViews.size(); ++i)
+        {
+            VkImageView attachments[2] = {imageViews[i], depthView};
+            VkFramebufferCreateInfo createInfo = {};
+            createInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            createInfo.renderPass = renderPass;
+            createInfo.attachmentCount = 2;
+            createInfo.pAttachments = attachments;
+            createInfo.width = swapchainExtent.width;
+            createInfo.height = swapchainExtent.height;
+            createInfo.layers = 1;
+            if (!check(vkCreateFramebuffer(device, &createInfo, nullptr, &framebuffers[i]), "FRAMEBUFFER_FAILED"))
+                return false;
+        }
+        return true;
+    }
+
+    bool createDescriptors()
+    {
+        VkDescriptorSetLayoutBinding binding = {};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings = &binding;
+        if (!check(vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &descriptorSetLayout), "DESCRIPTOR_LAYOUT_FAILED"))
+            return false;
+
+        VkDescriptorPoolSize poolSize = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, FRAME_COUNT};
+        VkDescriptorPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.maxSets = FRAME_COUNT;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
+        return check(vkCreateDescriptorPool(device, &poolInfo, nullptr, &descriptorPool), "DESCRIPTOR_POOL_FAILED");
+    }
+
+    bool loadShaderModule(const char *path, VkShaderModule &module)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            std::cerr << "ERROR::VULKAN::SHADER::FILE_NOT_READ " << path << " (shaders/build_shaders.sh ile derleyin)"
+                      << std::endl;
+            return false;
+        }
+        std::vector<char> code((size_t)file.tellg());
+        file.seekg(0);
+        file.read(code.data(), code.size());
+
+        VkShaderModuleCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.codeSize = code.size();
+        createInfo.pCode = (const uint32_t *)code.data();
+        return check(vkCreateShaderModule(device, &createInfo, nullptr, &module), "SHADER_MODULE_FAILED");
+    }
+
+    bool createPipeline(const char *vertexSpirvPath, const char *fragmentSpirvPath)
+    {
+        VkPushConstantRange pushRange = {VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(VulkanObjectData)};
+        VkPipelineLayoutCreateInfo layoutInfo = {};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        layoutInfo.setLayoutCount = 1;
+        layoutInfo.pSetLayouts = &descriptorSetLayout;
+        layoutInfo.pushConstantRangeCount = 1;
+        layoutInfo.pPushConstantRanges = &pushRange;
+        if (!check(vkCreatePipelineLayout(device, &layoutInfo, nullptr, &pipelineLayout), "PIPELINE_LAYOUT_FAILED"))
+            return false;
+
+        VkShaderModule vertexModule = VK_NULL_HANDLE, fragmentModule = VK_NULL_HANDLE;
+        if (!loadShaderModule(vertexSpirvPath, vertexModule) || !loadShaderModule(fragmentSpirvPath, fragmentModule))
+        {
+            vkDestroyShaderModule(device, vertexModule, nullptr);
+            return false;
+        }
+
+        VkPipelineShaderStageCreateInfo stages[2] = {};
+        stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stages[0].module = vertexModule;
+        stages[0].pName = "main";
+        stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        stages[1].module = fragmentModule;
+        stages[1].pName = "main";
+
+        VkVertexInputBindingDescription binding = {0, vertexStride, VK_VERTEX_INPUT_RATE_VERTEX};
+        VkPipelineVertexInputStateCreateInfo vertexInput = {};
+        vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertexInput.vertexBindingDescriptionCount = 1;
+        vertexInput.pVertexBindingDescriptions = &binding;
+        vertexInput.vertexAttributeDescriptionCount = (uint32_t)vertexAttributes.size();
+        vertexInput.pVertexAttributeDescriptions = vertexAttributes.data();
+
+        VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+        inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        // Viewport ve scissor dinamik: pencere boyutu değişince pipeline kalır
+        VkPipelineViewportStateCreateInfo viewportState = {};
+        viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewportState.viewportCount = 1;
+        viewportState.scissorCount = 1;
+        VkDynamicState dynamicStates[2] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+        VkPipelineDynamicStateCreateInfo dynamicState = {};
+        dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamicState.dynamicStateCount = 2;
+        dynamicState.pDynamicStates = dynamicStates;
+
+        // GL yolundaki gibi yüz ayıklama yok
+        VkPipelineRasterizationStateCreateInfo rasterization = {};
+        rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization.cullMode = VK_CULL_MODE_NONE;
+        rasterization.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterization.lineWidth = 1.0f;
+
+        VkPipelineMultisampleStateCreateInfo multisample = {};
+        multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkPipelineDepthStencilStateCreateInfo depthStencil = {};
+        depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+        depthStencil.depthTestEnable = VK_TRUE;
+        depthStencil.depthWriteEnable = VK_TRUE;
+        depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+
+        VkPipelineColorBlendAttachmentState blendAttachment = {};
+        blendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                         VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        VkPipelineColorBlendStateCreateInfo colorBlend = {};
+        colorBlend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        colorBlend.attachmentCount = 1;
+        colorBlend.pAttachments = &blendAttachment;
+
+        VkGraphicsPipelineCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        createInfo.stageCount = 2;
+        createInfo.pStages = stages;
+        createInfo.pVertexInputState = &vertexInput;
+        createInfo.pInputAssemblyState = &inputAssembly;
+        createInfo.pViewportState = &viewportState;
+        createInfo.pRasterizationState = &rasterization;
+        createInfo.pMultisampleState = &multisample;
+        createInfo.pDepthStencilState = &depthStencil;
+        createInfo.pColorBlendState = &colorBlend;
+        createInfo.pDynamicState = &dynamicState;
+        createInfo.layout = pipelineLayout;
+        createInfo.renderPass = renderPass;
+        createInfo.subpass = 0;
+        VkResult result = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &pipeline);
+
+        vkDestroyShaderModule(device, vertexModule, nullptr);
+        vkDestroyShaderModule(device, fragmentModule, nullptr);
+        return check(result, "PIPELINE_FAILED");
+    }
+
+    bool allocate(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties, VkDeviceMemory &memory)
+    {
+        VkPhysicalDeviceMemoryProperties memoryProperties;
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+        {
+            if ((requirements.memoryTypeBits & (1u << i)) &&
+                (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                VkMemoryAllocateInfo allocateInfo = {};
+                allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+                allocateInfo.allocationSize = requirements.size;
+                allocateInfo.memoryTypeIndex = i;
+                return check(vkAllocateMemory(device, &allocateInfo, nullptr, &memory), "ALLOCATE_FAILED");
+            }
+        }
+        std::cerr << "ERROR::VULKAN::NO_MEMORY_TYPE" << std::endl;
+        return false;
+    }
+
+    bool createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
+                      VkBuffer &buffer, VkDeviceMemory &memory)
+    {
+        VkBufferCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.size = size;
+        createInfo.usage = usage;
+        createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        if (!check(vkCreateBuffer(device, &createInfo, nullptr, &buffer), "BUFFER_FAILED"))
+            return false;
+
+        VkMemoryRequirements requirements;
+        vkGetBufferMemoryRequirements(device, buffer, &requirements);
+        if (!allocate(requirements, properties, memory))
+            return false;
+        vkBindBufferMemory(device, buffer, memory, 0);
+        return true;
+    }
+
+    void destroyBuffer(VkBuffer &buffer, VkDeviceMemory &memory)
+    {
+        vkDestroyBuffer(device, buffer, nullptr);
+        vkFreeMemory(device, memory, nullptr);
+        buffer = VK_NULL_HANDLE;
+        memory = VK_NULL_HANDLE;
+    }
+
+    // Host'tan device local tampona staging tamponu ve tek seferlik kopya ile
+    bool uploadBuffer(const void *data, VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer &buffer, VkDeviceMemory &memory)
+    {
+        VkBuffer staging = VK_NULL_HANDLE;
+        VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+        if (!createBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, staging, stagingMemory))
+            return false;
+        void *mapped = nullptr;
+        vkMapMemory(device, stagingMemory, 0, size, 0, &mapped);
+        std::memcpy(mapped, data, (size_t)size);
+        vkUnmapMemory(device, stagingMemory);
+
+        bool ok = createBuffer(size, usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, buffer, memory);
+        if (ok)
+        {
+            VkCommandBufferAllocateInfo allocateInfo = {};
+            allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocateInfo.commandPool = commandPool;
+            allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocateInfo.commandBufferCount = 1;
+            VkCommandBuffer commands;
+            vkAllocateCommandBuffers(device, &allocateInfo, &commands);
+
+            VkCommandBufferBeginInfo beginInfo = {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkBeginCommandBuffer(commands, &beginInfo);
+            VkBufferCopy region = {0, 0, size};
+            vkCmdCopyBuffer(commands, staging, buffer, 1, &region);
+            vkEndCommandBuffer(commands);
+
+            VkSubmitInfo submitInfo = {};
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &commands;
+            ok = check(vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE), "UPLOAD_SUBMIT_FAILED");
+            vkQueueWaitIdle(queue);
+            vkFreeCommandBuffers(device, commandPool, 1, &commands);
+        }
+        destroyBuffer(staging, stagingMemory);
+        return ok;
+    }
+
+    bool uploadGeometry()
+    {
+        if (draws.empty())
+        {
+            std::cerr << "ERROR::VULKAN::NO_GEOMETRY" << std::endl;
+            return false;
+        }
+        std::vector<unsigned char> gpuVertices = convert(vertices);
+        vertexCount = vertices.size() / 9;
+        indexCount = indices.size();
+        bool ok = uploadBuffer(gpuVertices.data(), gpuVertices.size(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, vertexBuffer, vertexMemory) &&
+                  uploadBuffer(indices.data(), indices.size() * sizeof(uint32_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT, indexBuffer, indexMemory);
+
+        std::vector<float>().swap(vertices);
+        std::vector<uint32_t>().swap(indices);
+        return ok;
+    }
+
+    bool createFrames()
+    {
+        VkCommandBufferAllocateInfo allocateInfo = {};
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.commandPool = commandPool;
+        allocateInfo.commandBufferCount = 1;
+
+        VkSemaphoreCreateInfo semaphoreInfo = {};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+        for (Frame &f : frames)
+        {
+            allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            vkAllocateCommandBuffers(device, &allocateInfo, &f.primary);
+            allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            vkAllocateCommandBuffers(device, &allocateInfo, &f.staticCommands);
+            vkAllocateCommandBuffers(device, &allocateInfo, &f.dynamicCommands);
+
+            if (!check(vkCreateSemaphore(device, &semaphoreInfo, nullptr, &f.imageAvailable), "SEMAPHORE_FAILED") ||
+                !check(vkCreateFence(device, &fenceInfo, nullptr, &f.fence), "FENCE_FAILED"))
+                return false;
+
+            // FrameData: kalıcı eşlenmiş, coherent; kareler fence ile ayrılır
+            if (!createBuffer(sizeof(FrameData), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              f.uniformBuffer, f.uniformMemory))
+                return false;
+            vkMapMemory(device, f.uniformMemory, 0, sizeof(FrameData), 0, &f.uniformData);
+
+            VkDescriptorSetAllocateInfo setInfo = {};
+            setInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            setInfo.descriptorPool = descriptorPool;
+            setInfo.descriptorSetCount = 1;
+            setInfo.pSetLayouts = &descriptorSetLayout;
+            if (!check(vkAllocateDescriptorSets(device, &setInfo, &f.descriptorSet), "DESCRIPTOR_SET_FAILED"))
+                return false;
+
+            VkDescriptorBufferInfo bufferInfo = {f.uniformBuffer, 0, sizeof(FrameData)};
+            VkWriteDescriptorSet write = {};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = f.descriptorSet;
+            write.dstBinding = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            write.pBufferInfo = &bufferInfo;
+            vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+        }
+        return true;
+    }
+
+    // İkincil tamponun ortak başlangıcı: pipeline, viewport, kare verisi, geometri
+    void beginSecondary(VkCommandBuffer commands, const Frame &f, VkCommandBufferUsageFlags usage)
+    {
+        VkCommandBufferInheritanceInfo inheritance = {};
+        inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritance.renderPass = renderPass;
+        inheritance.subpass = 0;
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | usage;
+        beginInfo.pInheritanceInfo = &inheritance;
+        vkBeginCommandBuffer(commands, &beginInfo);
+
+        VkViewport viewport = {0.0f, 0.0f, (float)swapchainExtent.width, (float)swapchainExtent.height, 0.0f, 1.0f};
+        VkRect2D scissor = {{0, 0}, swapchainExtent};
+        vkCmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        vkCmdSetViewport(commands, 0, 1, &viewport);
+        vkCmdSetScissor(commands, 0, 1, &scissor);
+        vkCmdBindDescriptorSets(commands, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &f.descriptorSet, 0, nullptr);
+        VkDeviceSize offset = 0;
+        vkCmdBindVertexBuffers(commands, 0, 1, &vertexBuffer, &offset);
+        vkCmdBindIndexBuffer(commands, indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+    }
+
+    static VulkanObjectData objectData(const glm::mat4 &model)
+    {
+        VulkanObjectData data;
+        data.model = model;
+        const glm::mat3 n = normalMatrix(model);
+        data.normalMatrix[0] = glm::vec4(n[0], 0.0f);
+        data.normalMatrix[1] = glm::vec4(n[1], 0.0f);
+        data.normalMatrix[2] = glm::vec4(n[2], 0.0f);
+        return data;
+    }
+
+    // Statik geometri bir kez kaydedilir; kare verisi uniform buffer'dan
+    // geldiği için kamera hareket etse de tampon geçerli kalır
+    void recordStaticCommands()
+    {
+        const VulkanObjectData identity = objectData(glm::mat4(1.0f));
+        for (Frame &f : frames)
+        {
+            vkResetCommandBuffer(f.staticCommands, 0);
+            beginSecondary(f.staticCommands, f, 0);
+            vkCmdPushConstants(f.staticCommands, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(identity), &identity);
+            for (const Draw &draw : draws)
+                if (draw.isStatic)
+                    vkCmdDrawIndexed(f.staticCommands, draw.indexCount, 1, draw.firstIndex, draw.vertexOffset, 0);
+            vkEndCommandBuffer(f.staticCommands);
+        }
+    }
+
+    void recordDynamicCommands(Frame &f, const glm::mat4 *models, size_t modelCount)
+    {
+        vkResetCommandBuffer(f.dynamicCommands, 0);
+        beginSecondary(f.dynamicCommands, f, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        for (const Draw &draw : draws)
+        {
+            if (draw.isStatic || !draw.enabled || draw.drawIndex >= modelCount)
+                continue;
+            const VulkanObjectData data = objectData(models[draw.drawIndex]);
+            vkCmdPushConstants(f.dynamicCommands, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(data), &data);
+            vkCmdDrawIndexed(f.dynamicCommands, draw.indexCount, 1, draw.firstIndex, draw.vertexOffset, 0);
+        }
+        vkEndCommandBuffer(f.dynamicCommands);
+    }
+
+    void recreateSwapchain()
+    {
+        // Simge durumundaki pencere: boyut tekrar sıfırdan büyük olana kadar bekle
+        int width = 0, height = 0;
+        glfwGetFramebufferSize(window, &width, &height);
+        while ((width == 0 || height == 0) && !glfwWindowShouldClose(window))
+        {
+            glfwWaitEvents();
+            glfwGetFramebufferSize(window, &width, &height);
+        }
+
+        vkDeviceWaitIdle(device);
+        destroySwapchain();
+        if (createSwapchain() && createFramebuffers())
+            recordStaticCommands();
+    }
+
+    void destroySwapchain()
+    {
+        for (VkFramebuffer framebuffer : framebuffers)
+            vkDestroyFramebuffer(device, framebuffer, nullptr);
+        for (VkImageView view : imageViews)
+            vkDestroyImageView(device, view, nullptr);
+        for (VkSemaphore semaphore : renderFinished)
+            vkDestroySemaphore(device, semaphore, nullptr);
+        framebuffers.clear();
+        imageViews.clear();
+        renderFinished.clear();
+        swapchainImages.clear();
+
+        vkDestroyImageView(device, depthView, nullptr);
+        vkDestroyImage(device, depthImage, nullptr);
+        vkFreeMemory(device, depthMemory, nullptr);
+        vkDestroySwapchainKHR(device, swapchain, nullptr);
+        depthView = VK_NULL_HANDLE;
+        depthImage = VK_NULL_HANDLE;
+        depthMemory = VK_NULL_HANDLE;
+        swapchain = VK_NULL_HANDLE;
+    }
+
+    void destroyInstance()
+    {
+        if (!instance)
+            return;
+        vkDestroySurfaceKHR(instance, surface, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        surface = VK_NULL_HANDLE;
+        instance = VK_NULL_HANDLE;
+    }
+
+    static const VkFormat DEPTH_FORMAT = VK_FORMAT_D32_SFLOAT; // Vulkan'da zorunlu
+
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<Draw> draws;
+    MeshOptimizeStats cacheStats; // Kaynaklanan / üretilen meshlerin sıralama istatistikleri
+    size_t vertexCount = 0;
+    size_t indexCount = 0;
+    uint32_t vertexStride = 0;
+    std::vector<VkVertexInputAttributeDescription> vertexAttributes;
+    std::vector<unsigned char> (*convert)(const std::vector<float> &) = nullptr;
+
+    GLFWwindow *window = nullptr;
+    VkInstance instance = VK_NULL_HANDLE;
+    VkSurfaceKHR surface = VK_NULL_HANDLE;
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    uint32_t queueFamily = 0;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+
+    VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+    VkFormat colorFormat = VK_FORMAT_UNDEFINED;
+    VkExtent2D swapchainExtent = {};
+    int framebufferWidth = 0, framebufferHeight = 0; // Swapchain kurulurken pencerenin boyutu
+    std::vector<VkImage> swapchainImages;
+    std::vector<VkImageView> imageViews;
+    std::vector<VkFramebuffer> framebuffers;
+    std::vector<VkSemaphore> renderFinished;
+    VkImage depthImage = VK_NULL_HANDLE;
+    VkDeviceMemory depthMemory = VK_NULL_HANDLE;
+    VkImageView depthView = VK_NULL_HANDLE;
+
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+    VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+
+    VkBuffer vertexBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory vertexMemory = VK_NULL_HANDLE;
+    VkBuffer indexBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory indexMemory = VK_NULL_HANDLE;
+
+    Frame frames[FRAME_COUNT];
+    uint32_t frameIndex = 0;
+};
+
+#endif // USE_VULKAN
+
+#endif